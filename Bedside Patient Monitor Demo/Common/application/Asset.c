@@ -0,0 +1,293 @@
+/**
+ * @file Asset.c
+ * @brief Residency of flash assets in RAM_G
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Platform.h"
+#include "EVE_CoCmd.h"
+
+#include "Common.h"
+#include "Asset.h"
+
+#define IS_ASTC(format)       (((format) >= COMPRESSED_RGBA_ASTC_4x4_KHR) && ((format) <= COMPRESSED_RGBA_ASTC_12x12_KHR))
+
+typedef struct Asset_State {
+	uint32_t addr;    /// RAM_G address, when resident
+	uint32_t lastUse; /// Frame of the last use
+	uint8_t resident;
+	uint8_t handle;   /// Font handle + 1 the xfont is bound to, 0 if none
+}Asset_State_t;
+
+static Asset_State_t s_state[ASSET_MAX];
+static const Asset_Info_t* s_manifest = NULL;
+static uint16_t s_count = 0;
+static uint32_t s_start = 0;
+static uint32_t s_end = 0;
+static uint32_t s_frame = 0;
+static Asset_Stats_t s_stats;
+
+/**
+ * @brief Size an asset takes in the pool
+ *
+ * @param id Asset id
+ * @return uint32_t Aligned size
+ */
+static uint32_t assetSize(uint16_t id) {
+	return ALIGN(s_manifest[id].size, ASSET_ALIGN);
+}
+
+/**
+ * @brief Find the lowest free range of the pool which fits a size
+ *
+ * @param size Aligned size
+ * @return uint32_t RAM_G address, ASSET_NOT_RESIDENT if none
+ */
+static uint32_t assetFindFree(uint32_t size) {
+	uint32_t best = ASSET_NOT_RESIDENT;
+	uint16_t i, j;
+
+	/// The free ranges start at the pool start, or at the end of a resident asset
+	for (i = 0; i <= s_count; i++) {
+		uint32_t addr;
+		if (i == s_count) {
+			addr = s_start;
+		}
+		else if (s_state[i].resident) {
+			addr = s_state[i].addr + assetSize(i);
+		}
+		else {
+			continue;
+		}
+		if (addr >= best || addr + size > s_end) {
+			continue;
+		}
+		for (j = 0; j < s_count; j++) {
+			if (s_state[j].resident && addr < s_state[j].addr + assetSize(j) && s_state[j].addr < addr + size) {
+				break;
+			}
+		}
+		if (j == s_count) {
+			best = addr;
+		}
+	}
+	return best;
+}
+
+/**
+ * @brief Evict the least recently used asset
+ * Assets used by the frame being built or the frame on screen are kept.
+ *
+ * @return int 1 if an asset was evicted
+ */
+static int assetEvictLru() {
+	uint16_t lru = s_count;
+	uint16_t i;
+
+	for (i = 0; i < s_count; i++) {
+		if (s_state[i].resident && (s_frame - s_state[i].lastUse) >= 2
+			&& (lru == s_count || s_state[i].lastUse < s_state[lru].lastUse)) {
+			lru = i;
+		}
+	}
+	if (lru == s_count) {
+		return 0;
+	}
+
+	s_state[lru].resident = 0;
+	s_state[lru].handle = 0;
+	s_stats.resident -= assetSize(lru);
+	s_stats.evictions++;
+	return 1;
+}
+
+/**
+ * @brief Start managing a manifest, with a RAM_G pool
+ * All assets start out of RAM_G, call again after RAM_G was overwritten.
+ *
+ * @param phost Pointer to Hal context
+ * @param manifest Asset table generated by EVE_AssetManifest
+ * @param count Number of assets in the table
+ * @param ramgStart Pool start, ASSET_ALIGN aligned
+ * @param ramgSize Pool size
+ */
+void Asset_Init(EVE_HalContext* phost, const Asset_Info_t* manifest, uint16_t count, uint32_t ramgStart, uint32_t ramgSize) {
+	(void)phost;
+	if (count > ASSET_MAX) {
+		printf("Asset manifest has %u entries, only %u are used\n", count, ASSET_MAX);
+		count = ASSET_MAX;
+	}
+	s_manifest = manifest;
+	s_count = count;
+	s_start = ramgStart;
+	s_end = ramgStart + ramgSize;
+	s_frame = 0;
+	memset(s_state, 0, sizeof(s_state));
+	memset(&s_stats, 0, sizeof(s_stats));
+}
+
+/**
+ * @brief Advance to the next frame, for the LRU accounting
+ *
+ */
+void Asset_Next_Frame() {
+	s_frame++;
+}
+
+/**
+ * @brief Make an asset resident in RAM_G
+ * The asset is copied from flash with CMD_FLASHREAD when not resident yet.
+ *
+ * @param phost Pointer to Hal context
+ * @param id Asset id
+ * @return uint32_t RAM_G address, ASSET_NOT_RESIDENT if it does not fit
+ */
+uint32_t Asset_Use(EVE_HalContext* phost, uint16_t id) {
+	Asset_State_t* state;
+	const Asset_Info_t* info;
+	uint32_t size;
+	uint32_t addr;
+
+	if (id >= s_count) {
+		return ASSET_NOT_RESIDENT;
+	}
+	state = &s_state[id];
+	info = &s_manifest[id];
+	state->lastUse = s_frame;
+	if (state->resident) {
+		return state->addr;
+	}
+
+	size = assetSize(id);
+	addr = assetFindFree(size);
+	while (addr == ASSET_NOT_RESIDENT && assetEvictLru()) {
+		addr = assetFindFree(size);
+	}
+	if (addr == ASSET_NOT_RESIDENT) {
+		printf("Asset %s does not fit in RAM_G\n", info->name);
+		return ASSET_NOT_RESIDENT;
+	}
+
+	EVE_CoCmd_flashRead(phost, addr, info->flashAddr, info->size);
+	state->addr = addr;
+	state->resident = 1;
+	s_stats.loads++;
+	s_stats.bytes += info->size;
+	s_stats.resident += size;
+	s_stats.highWater = max(s_stats.highWater, addr + size - s_start);
+	return addr;
+}
+
+/**
+ * @brief Set up the current bitmap handle for a bitmap asset
+ *
+ * @param phost Pointer to Hal context
+ * @param id Asset id
+ * @return int 1 on successful, 0 if the asset could not be loaded
+ */
+int Asset_Bitmap(EVE_HalContext* phost, uint16_t id) {
+	const Asset_Info_t* info;
+	uint32_t addr;
+
+	if (id >= s_count) {
+		return 0;
+	}
+	info = &s_manifest[id];
+#if ASSET_ASTC_FROM_FLASH
+	if (IS_ASTC(info->format)) {
+		s_state[id].lastUse = s_frame;
+		EVE_CoCmd_setBitmap(phost, ATFLASH(info->flashAddr), info->format, info->width, info->height);
+		return 1;
+	}
+#endif
+	addr = Asset_Use(phost, id);
+	if (addr == ASSET_NOT_RESIDENT) {
+		return 0;
+	}
+	EVE_CoCmd_setBitmap(phost, addr, info->format, info->width, info->height);
+	return 1;
+}
+
+/**
+ * @brief Bind an extended font asset to a font handle
+ * CMD_SETFONT2 is only sent when the handle is not bound to the resident xfont yet.
+ *
+ * @param phost Pointer to Hal context
+ * @param id Asset id of the .xfont
+ * @param handle Font handle
+ * @return int 1 if the handle was bound now, for example to set up its font cache again, 0 otherwise
+ */
+int Asset_Font(EVE_HalContext* phost, uint16_t id, uint32_t handle) {
+	uint32_t addr = Asset_Use(phost, id);
+	uint16_t i;
+
+	if (addr == ASSET_NOT_RESIDENT || s_state[id].handle == handle + 1) {
+		return 0;
+	}
+	for (i = 0; i < s_count; i++) {
+		if (s_state[i].handle == handle + 1) {
+			s_state[i].handle = 0;
+		}
+	}
+	EVE_CoCmd_setFont2(phost, handle, addr, 0);
+	s_state[id].handle = (uint8_t)(handle + 1);
+	return 1;
+}
+
+/**
+ * @brief Evict all assets, for example when the pool was overwritten
+ *
+ */
+void Asset_Evict_All() {
+	uint16_t i;
+
+	for (i = 0; i < s_count; i++) {
+		s_state[i].resident = 0;
+		s_state[i].handle = 0;
+	}
+	s_stats.resident = 0;
+}
+
+/**
+ * @brief Get the residency statistics since Asset_Init
+ *
+ * @return const Asset_Stats_t*
+ */
+const Asset_Stats_t* Asset_Get_Stats() {
+	return &s_stats;
+}
+
+/**
+ * @brief Print the residency statistics since Asset_Init
+ *
+ */
+void Asset_Print_Stats() {
+	printf("Assets: %u loads, %u bytes from flash, %u evictions, %u of %u bytes resident, high water %u\n",
+		(unsigned)s_stats.loads, (unsigned)s_stats.bytes, (unsigned)s_stats.evictions,
+		(unsigned)s_stats.resident, (unsigned)(s_end - s_start), (unsigned)s_stats.highWater);
+}
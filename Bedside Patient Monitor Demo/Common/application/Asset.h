@@ -0,0 +1,82 @@
+/**
+ * @file Asset.h
+ * @brief Residency of flash assets in RAM_G
+ *
+ * Assets are described by a manifest generated from the flash image with
+ * Tools/EVE_AssetManifest.c. An asset is copied from flash into a RAM_G pool
+ * the first time it is drawn. When the pool is full, the least recently used
+ * assets are evicted, except those used by the frame being built or the frame
+ * on screen. Call Asset_Next_Frame once per frame.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ASSET_H_
+#define ASSET_H_
+
+#include "EVE_Platform.h"
+
+#define ASSET_FORMAT_XFONT    0xFFFFFFFE /// Extended font header, bound with CMD_SETFONT2
+#define ASSET_FORMAT_RAW      0xFFFFFFFF /// Data of unknown format
+
+#define ASSET_NOT_RESIDENT    0xFFFFFFFF /// Returned by Asset_Use when the asset does not fit in the pool
+#define ASSET_ALIGN           64         /// RAM_G alignment of each asset, enough for bitmaps and CMD_SETFONT2
+#define ASSET_MAX             256        /// Number of manifest entries tracked
+
+/// Draw ASTC bitmaps directly from flash, they then take no RAM_G. Needs flash in full mode
+#ifndef ASSET_ASTC_FROM_FLASH
+#define ASSET_ASTC_FROM_FLASH 0
+#endif
+
+typedef struct Asset_Info {
+	const char *name;
+	uint32_t flashAddr; /// 64-byte aligned
+	uint32_t size;      /// Bytes to copy, including the padding, multiple of 4
+	uint32_t format;    /// Bitmap format, or ASSET_FORMAT_XFONT / ASSET_FORMAT_RAW
+	uint16_t width;
+	uint16_t height;
+}Asset_Info_t;
+
+typedef struct Asset_Stats {
+	uint32_t loads;     /// Copies from flash into RAM_G
+	uint32_t evictions; /// Assets evicted to make room
+	uint32_t bytes;     /// Bytes copied from flash
+	uint32_t resident;  /// Bytes resident now
+	uint32_t highWater; /// Highest end of the pool in use, relative to its start
+}Asset_Stats_t;
+
+void Asset_Init(EVE_HalContext *phost, const Asset_Info_t *manifest, uint16_t count, uint32_t ramgStart, uint32_t ramgSize);
+void Asset_Next_Frame();
+uint32_t Asset_Use(EVE_HalContext *phost, uint16_t id);
+int Asset_Bitmap(EVE_HalContext *phost, uint16_t id);
+int Asset_Font(EVE_HalContext *phost, uint16_t id, uint32_t handle);
+void Asset_Evict_All();
+
+const Asset_Stats_t* Asset_Get_Stats();
+void Asset_Print_Stats();
+
+#endif /* ASSET_H_ */
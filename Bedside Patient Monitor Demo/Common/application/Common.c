@@ -266,6 +266,9 @@
  #endif
  
 	 EVE_Hal_open(phost, &params);
+#if EVE_HAL_TRACE
+	 EVE_HalTrace_start(phost, "eve_trace.bin");
+#endif
 	 EVE_Util_bootupConfig(phost);
  
  #ifdef DISPLAY_RESOLUTION_WXGA
@@ -371,12 +374,28 @@
  }
  
  void Calibration_Restore(EVE_HalContext* phost) {
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_A, a);
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_B, b);
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_C, c);
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_D, d);
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_E, e);
-	 EVE_Hal_wr32(phost, REG_TOUCH_TRANSFORM_F, f);
+	 // The transform registers are contiguous, this is written in one transfer
+	 const uint32_t transform[6] = { a, b, c, d, e, f };
+	 uint8_t le[6][4];
+	 int i;
+
+	 // Registers are little-endian, whatever the host byte order is
+	 for (i = 0; i < 6; i++) {
+		 le[i][0] = transform[i] & 0xFF;
+		 le[i][1] = (transform[i] >> 8) & 0xFF;
+		 le[i][2] = (transform[i] >> 16) & 0xFF;
+		 le[i][3] = transform[i] >> 24;
+	 }
+
+	 const EVE_IoVec v[] = {
+		 { REG_TOUCH_TRANSFORM_A, le[0], 4 },
+		 { REG_TOUCH_TRANSFORM_B, le[1], 4 },
+		 { REG_TOUCH_TRANSFORM_C, le[2], 4 },
+		 { REG_TOUCH_TRANSFORM_D, le[3], 4 },
+		 { REG_TOUCH_TRANSFORM_E, le[4], 4 },
+		 { REG_TOUCH_TRANSFORM_F, le[5], 4 },
+	 };
+	 EVE_Hal_wrv(phost, v, sizeof(v) / sizeof(v[0]));
  }
  
  void Calibration_Save(EVE_HalContext* phost) {
@@ -456,6 +475,7 @@
  }
  
  void Display_StartColor(EVE_HalContext* phost, uint8_t *bgColor, uint8_t *textColor) {
+	 EVE_Cmd_frameBegin(phost);
 	 EVE_CoCmd_dlStart(phost);
 	 EVE_Cmd_wr32(phost, CLEAR_COLOR_RGB(bgColor[0], bgColor[1], bgColor[2]));
 	 EVE_Cmd_wr32(phost, CLEAR(1, 1, 1));
@@ -468,9 +488,18 @@
  }
  
  void Display_End(EVE_HalContext* phost) {
+	 if (!EVE_Cmd_frameEnd(phost)) {
+		 // Same as the frame on screen, wait for the next scanout instead of swapping
+		 EVE_Cmd_frameWait(phost);
+		 return;
+	 }
 	 EVE_Cmd_wr32(phost, DISPLAY());
 	 EVE_CoCmd_swap(phost);
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	 EVE_Cmd_submitFrame(phost);
+#else
 	 EVE_Cmd_waitFlush(phost);
+#endif
  }
  
  static void Gpu_Text(EVE_HalContext* phost, const char8_t* str, uint8_t *bgColor, uint8_t *textColor) {
@@ -567,6 +596,8 @@
  uint8_t isSDcardDetected() {
  #if defined(MSVC_PLATFORM) || defined(BT8XXEMU_PLATFORM)
 	 return true;
+ #elif defined(NULLDEV_PLATFORM)
+	 return false; /* No flash to program, skip the dialog when running headless */
  #elif defined(FT9XX_PLATFORM)
 	 return sdhost_card_detect() == SDHOST_CARD_INSERTED;
  #else
@@ -581,12 +612,13 @@
  // return filesize
  uint32_t Flash_Init(EVE_HalContext* phost, const uint8_t *filePath,
 		 const uint8_t *fileName, uint32_t address) {
- #if defined(_WIN32)
+ #if defined(_WIN32) || defined(__linux__)
  #define _WHERE "PC"
  #elif defined(EMBEDDED_PLATFORM)
  #define _WHERE "SDcard"
  #endif
 	 uint32_t sent = 0;
+	 char manifest[300];
  
 	 EVE_Util_loadSdCard(phost);
  #if defined(EVE_FLASH_AVAILABLE)
@@ -603,9 +635,18 @@
 			 return 0;
 		 }
  
-		 /// If YES, Program the flash with the file in SD card
-		 sent = Ftf_Write_File_To_Flash_With_Progressbar(phost, filePath,
-				 fileName, address);
+		 /// If YES, Program the flash with the file in SD card,
+		 /// only the changed sectors when the file comes with a manifest from Tools/EVE_FlashManifest.c
+		 snprintf(manifest, sizeof(manifest), "%s.crc", (const char *)filePath);
+		 if (FileIO_File_Open(manifest, FILEIO_E_FOPEN_READ) > 0) {
+			 FileIO_File_Close();
+			 hintScreen(phost, (const uint8_t *)"Updating the changed flash sectors");
+			 sent = Ftf_Write_File_To_Flash_Delta(phost, (const char *)filePath, manifest,
+					 address);
+		 } else {
+			 sent = Ftf_Write_File_To_Flash_With_Progressbar(phost, (const char *)filePath,
+					 (const char *)fileName, address);
+		 }
  
 		 /// If fail to program flash, reset application
 		 if (0 >= sent) {
@@ -49,6 +49,8 @@
  #include "Logo.h"
  #include "Maths.h"
  #include "Image.h"
+ #include "Asset.h"
+ #include "FontCache.h"
  #include "FlashHelper.h"
  
  
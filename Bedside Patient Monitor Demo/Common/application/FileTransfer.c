@@ -44,6 +44,17 @@
 
 #define BLOBSIZE              4096
 
+/// Size of each of the two RAM_G regions the flash programmer stages blocks into, multiple of 4096
+#if defined(FT9XX_PLATFORM) || defined(RP2040_PLATFORM)
+#define FLASH_PIPE_BLOCK      (8 * 1024)
+#else
+#define FLASH_PIPE_BLOCK      (64 * 1024)
+#endif
+#define FLASH_PIPE_RAM_G      RAM_G
+#define FLASH_PIPE_SCRATCH    (FLASH_PIPE_RAM_G + 2 * FLASH_PIPE_BLOCK) /// Flash content is read here for the CRC check
+
+#define FLASH_MANIFEST_MAGIC  0x52434645 /// "EFCR", first word of a manifest written by Tools/EVE_FlashManifest.c
+
 #if defined(MSVC_PLATFORM) || defined(BT8XXEMU_PLATFORM)
 #define EVE_FLASH_DIR         __FILE__ "\\..\\..\\..\\common\\eve_flash"
 #else
@@ -65,6 +76,152 @@
 extern uint8_t BUFFER_BLOB[4096];
 
 #if defined(EVE_FLASH_AVAILABLE)
+static Ftf_Flash_Stats_t s_flashStats;
+
+/**
+ * @brief Compute the CRC-32 of a buffer, the same as CMD_MEMCRC
+ *
+ * @param data Data buffer
+ * @param size Size of the data
+ * @return uint32_t CRC-32
+ */
+static uint32_t Ftf_Crc32(const uint8_t* data, uint32_t size) {
+	static const uint32_t table[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+	uint32_t crc = 0xFFFFFFFF;
+
+	while (size--) {
+		crc = table[(crc ^ *data) & 0x0F] ^ (crc >> 4);
+		crc = table[(crc ^ (*data >> 4)) & 0x0F] ^ (crc >> 4);
+		data++;
+	}
+	return ~crc;
+}
+
+/**
+ * @brief Program the next bytes of the opened file into flash
+ * Blocks are staged alternately into two RAM_G regions, so the next block is
+ * transferred while CMD_FLASHUPDATE programs the previous one. With check,
+ * blocks whose CRC matches the current flash content are not transferred at all.
+ *
+ * @param phost Pointer to Hal context
+ * @param addr Address on flash, 4096-byte aligned
+ * @param size Number of bytes to program
+ * @param check 1 to skip blocks already in flash, 0 when the caller knows they differ
+ * @return uint32_t Number of bytes programmed or skipped, 0 on error
+ */
+static uint32_t Ftf_Flash_Pipeline(EVE_HalContext* phost, uint32_t addr, uint32_t size, int check) {
+	const uint32_t blocks = (size + FLASH_PIPE_BLOCK - 1) / FLASH_PIPE_BLOCK;
+	uint8_t* pbuff = (uint8_t*)malloc(FLASH_PIPE_BLOCK);
+	uint32_t* flashCrc = (uint32_t*)malloc(blocks * sizeof(uint32_t));
+	uint32_t start = EVE_millis();
+	uint32_t sent = 0;
+	uint32_t i;
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	uint32_t fence[2] = { 0, 0 };
+#endif
+
+	if (!pbuff || !flashCrc) {
+		printf("Unable to malloc\n");
+		free(pbuff);
+		free(flashCrc);
+		return 0;
+	}
+
+	/// CRC of the current flash content, the coprocessor reads it into RAM_G without crossing the bus
+	for (i = 0; check && i < blocks; i++) {
+		uint32_t bytes = min(FLASH_PIPE_BLOCK, size - i * FLASH_PIPE_BLOCK);
+		EVE_CoCmd_flashRead(phost, FLASH_PIPE_SCRATCH, addr + i * FLASH_PIPE_BLOCK, ALIGN(bytes, FLASH_READ_ALIGN_BYTE));
+		if (!EVE_CoCmd_memCrc(phost, FLASH_PIPE_SCRATCH, bytes, &flashCrc[i])) {
+			printf("Error when reading flash\n");
+			free(pbuff);
+			free(flashCrc);
+			return 0;
+		}
+	}
+
+	for (i = 0; i < blocks; i++) {
+		uint32_t bytes = min(FLASH_PIPE_BLOCK, size - sent);
+		uint32_t aligned = ALIGN(bytes, FLASH_UPDATE_ALIGN_BYTE);
+		uint32_t region = FLASH_PIPE_RAM_G + (i & 1) * FLASH_PIPE_BLOCK;
+		uint32_t read = 0;
+
+		while (read < bytes) {
+			int ret = FileIO_File_Read((char*)&pbuff[read], bytes - read);
+			if (ret <= 0) {
+				printf("Error on reading file\n");
+				EVE_Cmd_waitFlush(phost);
+				free(pbuff);
+				free(flashCrc);
+				return 0;
+			}
+			read += ret;
+		}
+		sent += bytes;
+
+		if (check && Ftf_Crc32(pbuff, bytes) == flashCrc[i]) {
+			s_flashStats.skipped += bytes;
+			continue;
+		}
+
+#if EVE_CMD_FRAMES_IN_FLIGHT
+		/// Wait for the CMD_FLASHUPDATE which last read this region
+		if (fence[i & 1] && !EVE_Cmd_waitFrame(phost, fence[i & 1])) {
+			free(pbuff);
+			free(flashCrc);
+			return 0;
+		}
+#endif
+		memset(&pbuff[bytes], 0xFF, aligned - bytes); /// Pad the last block like erased flash
+		EVE_Hal_wrMem(phost, region, pbuff, aligned);
+		EVE_CoCmd_flashUpdate(phost, addr + i * FLASH_PIPE_BLOCK, region, aligned);
+#if EVE_CMD_FRAMES_IN_FLIGHT
+		/// The frame fence marks when the update is done, the coprocessor starts on it without waiting
+		fence[i & 1] = EVE_Cmd_submitFrame(phost);
+#else
+		EVE_Cmd_waitFlush(phost);
+#endif
+		s_flashStats.written += bytes;
+	}
+	EVE_Cmd_waitFlush(phost);
+
+	free(pbuff);
+	free(flashCrc);
+	s_flashStats.bytes += sent;
+	s_flashStats.millis += EVE_millis() - start;
+	return sent;
+}
+
+/**
+ * @brief Reset the flash programming statistics
+ *
+ */
+void Ftf_Flash_Reset_Stats() {
+	memset(&s_flashStats, 0, sizeof(s_flashStats));
+}
+
+/**
+ * @brief Get the flash programming statistics since the last reset
+ *
+ * @return const Ftf_Flash_Stats_t*
+ */
+const Ftf_Flash_Stats_t* Ftf_Flash_Get_Stats() {
+	return &s_flashStats;
+}
+
+/**
+ * @brief Print the flash programming statistics since the last reset
+ *
+ */
+void Ftf_Flash_Print_Stats() {
+	printf("Flash: %u bytes in %u ms, %u KB/s, %u bytes programmed, %u bytes unchanged\n",
+		(unsigned)s_flashStats.bytes, (unsigned)s_flashStats.millis,
+		(unsigned)(s_flashStats.millis ? (uint64_t)s_flashStats.bytes * 1000 / 1024 / s_flashStats.millis : 0),
+		(unsigned)s_flashStats.written, (unsigned)s_flashStats.skipped);
+}
+
 /**
  * @brief Erase flash
  *
@@ -272,6 +429,7 @@ Ftf_Progress_t* Ftf_Progress_Init(EVE_HalContext* phost, const char* filePath, c
 
 		snprintf(progress.message, MSG_SIZE, "Writing %s to flash", progress.fileName);
 		progress.fileSize = fileSize;
+		Ftf_Flash_Reset_Stats();
 
 	}
 
@@ -293,36 +451,18 @@ Ftf_Progress_t* Ftf_Progress_Init(EVE_HalContext* phost, const char* filePath, c
  * @return uint32_t Percent of data transfered, 100 mean file transfer is done
  */
 uint32_t Ftf_Progress_Write_Next(EVE_HalContext* phost, Ftf_Progress_t* progress) {
-	uint8_t pbuff[FREAD_BLOCK];
-	uint32_t bytes;
-	uint32_t sent = 0;
-	uint32_t ramGSent = 0;
-	uint32_t blockSize = 0;
+	uint32_t bytes = progress->fileSize - progress->sent;
 
 	// Tranfer 1 percent of file
-	while (progress->sent < progress->fileSize && sent < progress->bytesPerPercent) {
-		blockSize = FREAD_BLOCK > progress->bytesPerPercent ? progress->bytesPerPercent : FREAD_BLOCK;
-
-		// Tranfer to ram_g
-		while (ramGSent < RAM_G_SIZE && progress->sent < progress->fileSize && sent < progress->bytesPerPercent) {
-			bytes = FileIO_File_Read(pbuff, blockSize);
-
-			if (0 == bytes) {
-				printf("Error on reading file: %s\n", progress->file);
-				return 0;
-			}
-			EVE_Hal_wrMem(phost, ramGSent, pbuff, bytes);
-			EVE_Cmd_waitFlush(phost);
-			ramGSent += bytes;
-			sent += bytes;
-			progress->sent += bytes;
-		}
-
-		// Update flash from ram_g
-		ramGSent = (ramGSent + 4095) & (~4095);//to ensure 4KB alignment
-		FlashHelper_Update(phost, progress->addr, 0, ramGSent);
-		progress->addr += ramGSent;
+	if (bytes > progress->bytesPerPercent) {
+		bytes = progress->bytesPerPercent;
 	}
+	if (bytes && !Ftf_Flash_Pipeline(phost, progress->addr, bytes, 1)) {
+		printf("Error on writing file: %s\n", progress->file);
+		return 0;
+	}
+	progress->sent += bytes;
+	progress->addr += bytes;
 
 	return progress->sent * 100 / progress->fileSize; /* Percent */
 }
@@ -444,6 +584,7 @@ uint32_t Ftf_Write_File_To_Flash_With_Progressbar(EVE_HalContext* phost, const c
 		}
 	}
 	Ftf_Progress_Close();
+	Ftf_Flash_Print_Stats();
 
 	return progress->fileSize;
 }
@@ -506,9 +647,7 @@ uint32_t Ftf_Write_File_To_Flash_By_Cmd_Fifo(EVE_HalContext* phost, const char*
 		return 0;
 	}
 
-	EVE_Cmd_wr32(phost, CMD_FLASHWRITE);
-	EVE_Cmd_wr32(phost, addr);
-	EVE_Cmd_wr32(phost, ALIGN(fileSize, FLASH_WRITE_ALIGN_BYTE));
+	EVE_CoCmd_flashWrite(phost, addr, ALIGN(fileSize, FLASH_WRITE_ALIGN_BYTE));
 
 	/// Download data to Coprocessor
 	blocklen = FileIO_File_Read(pBuff, EVE_CMD_FIFO_SIZE);
@@ -556,9 +695,7 @@ uint32_t Ftf_Write_FileArr_To_Flash_By_Cmd_Fifo(EVE_HalContext* phost, const cha
 		i++;
 	}
 
-	EVE_Cmd_wr32(phost, CMD_FLASHWRITE);
-	EVE_Cmd_wr32(phost, addr);
-	EVE_Cmd_wr32(phost, ALIGN(allSize, FLASH_WRITE_ALIGN_BYTE));
+	EVE_CoCmd_flashWrite(phost, addr, ALIGN(allSize, FLASH_WRITE_ALIGN_BYTE));
 
 	i = 0;
 	while (file[i] != NULL) {
@@ -599,11 +736,7 @@ uint32_t Ftf_Write_FileArr_To_Flash_By_Cmd_Fifo(EVE_HalContext* phost, const cha
  * @return int Number of bytes transfered on successful, 0 on error
  */
 uint32_t Ftf_Write_File_To_Flash_By_RAM_G(EVE_HalContext* phost, const char* fileName, uint32_t addr) {
-	const uint32_t bufferSize = FREAD_BLOCK;
-	uint8_t pbuff[FREAD_BLOCK];
-	uint32_t bytes;
 	uint32_t sent = 0;
-	uint32_t ramGSent = 0;
 
 	// update blob from file first
 	if (addr < BLOBSIZE) {
@@ -637,28 +770,180 @@ uint32_t Ftf_Write_File_To_Flash_By_RAM_G(EVE_HalContext* phost, const char* fil
 	}
 
 	/// Transfer rest of file to EVE (in fast mode)
-	while (sent < fileSize) {
-		// Fill up RAM_G
-		while (ramGSent < RAM_G_SIZE && sent < fileSize) {
-			bytes = FileIO_File_Read(pbuff, bufferSize);
-			if (0 == bytes) {
-				printf("Error on reading file: %s\n", fileName);
-				return 0;
-			}
-			EVE_Hal_wrMem(phost, ramGSent, pbuff, bytes);
+	Ftf_Flash_Reset_Stats();
+	if (sent < fileSize && !Ftf_Flash_Pipeline(phost, addr, fileSize - sent, 1)) {
+		printf("Error on writing file: %s\n", fileName);
+		FileIO_File_Close();
+		return 0;
+	}
+	sent = fileSize;
+	FileIO_File_Close();
+	Ftf_Flash_Print_Stats();
+
+	return sent; /* File size */
+}
+
+/**
+ * @brief Load a flash manifest generated by Tools/EVE_FlashManifest.c
+ * Layout, little-endian 32-bit words: FLASH_MANIFEST_MAGIC, sector size,
+ * image size, then the CRC-32 of each sector of the image.
+ *
+ * @param manifestName Manifest file
+ * @param imageSize Receives the size of the image the manifest describes
+ * @return uint32_t* Sector CRCs, to free, NULL on error
+ */
+static uint32_t* Ftf_Load_Manifest(const char* manifestName, uint32_t* imageSize) {
+	uint32_t header[3];
+	uint32_t* crc = NULL;
+	uint32_t sectors;
+
+	if (FileIO_File_Open(manifestName, FILEIO_E_FOPEN_READ) < (int)sizeof(header)
+		|| FileIO_File_Read((char*)header, sizeof(header)) != sizeof(header)
+		|| header[0] != FLASH_MANIFEST_MAGIC || header[1] != FLASH_SECTOR_SIZE) {
+		printf("Invalid flash manifest: %s\n", manifestName);
+		FileIO_File_Close();
+		return NULL;
+	}
+
+	sectors = (header[2] + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE;
+	crc = (uint32_t*)malloc(max(sectors, 1) * sizeof(uint32_t));
+	if (!crc || FileIO_File_Read((char*)crc, sectors * sizeof(uint32_t)) != (int)(sectors * sizeof(uint32_t))) {
+		printf("Invalid flash manifest: %s\n", manifestName);
+		FileIO_File_Close();
+		free(crc);
+		return NULL;
+	}
+	FileIO_File_Close();
+
+	*imageSize = header[2];
+	return crc;
+}
+
+/**
+ * @brief Program a run of changed sectors of the opened file
+ *
+ * @param phost Pointer to Hal context
+ * @param addr Address of the file on flash
+ * @param run First changed sector
+ * @param runEnd Sector after the last changed one
+ * @param imageSize Size of the file
+ * @return uint32_t 1 on successful, 0 on error
+ */
+static uint32_t Ftf_Flash_Delta_Run(EVE_HalContext* phost, uint32_t addr, uint32_t run, uint32_t runEnd, uint32_t imageSize) {
+	uint32_t offset = run * FLASH_SECTOR_SIZE;
+	uint32_t size = min(runEnd * FLASH_SECTOR_SIZE, imageSize) - offset;
 
-			ramGSent += bytes;
-			sent += bytes;
+	return FileIO_File_Seek(offset) && Ftf_Flash_Pipeline(phost, addr + offset, size, 0);
+}
+
+/**
+ * @brief Write only the sectors of a file which differ from the flash content
+ * The CRC of each 4096-byte sector of flash is computed by the coprocessor,
+ * and compared with the manifest of the file, so neither the file nor the flash
+ * content needs to be read for unchanged sectors. Runs of changed sectors are
+ * transferred and programmed with CMD_FLASHUPDATE. The statistics report the
+ * bytes actually transferred.
+ *
+ * @param phost Pointer to Hal context
+ * @param fileName File to write
+ * @param manifestName Sector CRC manifest of the file
+ * @param addr Address on flash, 4096-byte aligned
+ * @return uint32_t Size of the file on successful, 0 on error
+ */
+uint32_t Ftf_Write_File_To_Flash_Delta(EVE_HalContext* phost, const char* fileName, const char* manifestName, uint32_t addr) {
+	uint32_t flashCrc[FLASH_SECTOR_CRC_MAX];
+	uint32_t start = EVE_millis();
+	uint32_t imageSize = 0;
+	uint32_t sectors;
+	uint32_t first = 0;
+	uint32_t run = 0;
+	uint32_t runEnd = 0;
+	uint32_t i, j;
+	uint32_t* crc;
+
+	if (addr % FLASH_SECTOR_SIZE) {
+		printf("Flash address must be %u-byte aligned\n", FLASH_SECTOR_SIZE);
+		return 0;
+	}
+
+	crc = Ftf_Load_Manifest(manifestName, &imageSize);
+	if (!crc) {
+		return 0;
+	}
+	sectors = (imageSize + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE;
+	Ftf_Flash_Reset_Stats();
+
+	if (addr < BLOBSIZE) {
+		/// The blob is in the first sector, rewrite it when it differs or full mode fails
+		if (sectors && (FlashHelper_SwitchState(phost, FLASH_STATUS_FULL) != 0
+			|| FlashHelper_SectorCrc(phost, FLASH_PIPE_SCRATCH, 0, min(BLOBSIZE, imageSize), flashCrc) != FLASH_CMD_SUCCESS
+			|| flashCrc[0] != crc[0])) {
+			Ftf_Write_BlobFile(phost, fileName);
+			s_flashStats.written += min(BLOBSIZE, imageSize);
+		}
+		else {
+			s_flashStats.skipped += min(BLOBSIZE, imageSize);
 		}
+		s_flashStats.bytes += min(BLOBSIZE, imageSize);
+		first = 1;
+	}
+	if (FlashHelper_SwitchState(phost, FLASH_STATUS_FULL) != 0) {
+		/// check and write blob
+		Ftf_Write_Blob_Default(phost);
+		if (FlashHelper_SwitchState(phost, FLASH_STATUS_FULL) != 0) {
+			printf("Cannot switch flash to fullmode\n");
+			free(crc);
+			return 0;
+		}
+	}
 
-		// Send RAM_G to Flash
-		ramGSent = (ramGSent + 4095) & (~4095);//to ensure 4KB alignment
-		FlashHelper_Update(phost, addr, 0, ramGSent);
-		addr += ramGSent;
+	if ((uint32_t)FileIO_File_Open(fileName, FILEIO_E_FOPEN_READ) != imageSize) {
+		printf("Flash manifest %s does not match file: %s\n", manifestName, fileName);
+		FileIO_File_Close();
+		free(crc);
+		return 0;
+	}
+
+	/// Sectors from run to runEnd differ, they are programmed once a matching sector or the end is reached
+	run = runEnd = first;
+	for (i = first; i < sectors; i += FLASH_SECTOR_CRC_MAX) {
+		uint32_t count = min(FLASH_SECTOR_CRC_MAX, sectors - i);
+		uint32_t bytes = min(count * FLASH_SECTOR_SIZE, imageSize - i * FLASH_SECTOR_SIZE);
+
+		if (FlashHelper_SectorCrc(phost, FLASH_PIPE_SCRATCH, addr + i * FLASH_SECTOR_SIZE, bytes, flashCrc) != FLASH_CMD_SUCCESS) {
+			printf("Error when reading flash\n");
+			break;
+		}
+		for (j = 0; j < count; j++) {
+			uint32_t sector = i + j;
+			if (flashCrc[j] != crc[sector]) {
+				runEnd = sector + 1;
+				continue;
+			}
+			if (runEnd > run && !Ftf_Flash_Delta_Run(phost, addr, run, runEnd, imageSize)) {
+				break;
+			}
+			s_flashStats.bytes += min(FLASH_SECTOR_SIZE, imageSize - sector * FLASH_SECTOR_SIZE);
+			s_flashStats.skipped += min(FLASH_SECTOR_SIZE, imageSize - sector * FLASH_SECTOR_SIZE);
+			run = runEnd = sector + 1;
+		}
+		if (j < count) {
+			break;
+		}
+	}
+	if (i >= sectors && runEnd > run && !Ftf_Flash_Delta_Run(phost, addr, run, runEnd, imageSize)) {
+		i = 0;
 	}
 	FileIO_File_Close();
+	free(crc);
 
-	return sent; /* File size */
+	s_flashStats.millis = EVE_millis() - start;
+	Ftf_Flash_Print_Stats();
+	if (i < sectors) {
+		printf("Error on writing file: %s\n", fileName);
+		return 0;
+	}
+	return imageSize;
 }
 
 /**
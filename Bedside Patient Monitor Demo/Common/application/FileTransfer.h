@@ -54,6 +54,13 @@ typedef struct Ftf_Progress {
 	uint8_t direction;
 }Ftf_Progress_t;
 
+typedef struct Ftf_Flash_Stats {
+	uint32_t bytes;   /// Bytes of file data handled
+	uint32_t written; /// Bytes transferred and programmed
+	uint32_t skipped; /// Bytes skipped because the flash already holds them
+	uint32_t millis;  /// Time spent programming
+}Ftf_Flash_Stats_t;
+
 #if defined(EVE_FLASH_AVAILABLE)
 uint32_t Ftf_Flash_Erase(EVE_HalContext *phost);
 uint32_t Ftf_Flash_ClearCache(EVE_HalContext* phost);
@@ -74,10 +81,15 @@ uint32_t Ftf_Write_FileArr_To_Flash_By_Cmd_Fifo(EVE_HalContext* phost, const cha
 
 uint32_t Ftf_Write_File_To_Flash_By_RAM_G(EVE_HalContext *phost, const char *fileName, uint32_t addr);
 uint32_t Ftf_Write_FileArr_To_Flash_By_RAM_G(EVE_HalContext *phost, const char *file[], uint32_t addr);
+uint32_t Ftf_Write_File_To_Flash_Delta(EVE_HalContext *phost, const char *fileName, const char *manifestName, uint32_t addr);
 
 uint32_t Ftf_Read_File_From_Flash(EVE_HalContext *phost, const uint8_t *output, uint32_t address, uint32_t size);
 
 uint32_t Ftf_Flash_Get_Size(EVE_HalContext *phost);
+
+void Ftf_Flash_Reset_Stats();
+const Ftf_Flash_Stats_t* Ftf_Flash_Get_Stats();
+void Ftf_Flash_Print_Stats();
 #endif
 
 uint32_t Ftf_Write_File_nBytes_To_RAM_G(EVE_HalContext *phost, const char *file, uint32_t addr, int nbytes, int offset);
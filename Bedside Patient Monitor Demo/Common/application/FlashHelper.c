@@ -151,6 +151,58 @@ Flash_Cmd_Status_t FlashHelper_Read(EVE_HalContext* phost, uint32_t dest_ram, ui
 }
 #endif
 
+#ifdef EVE_FLASH_AVAILABLE
+/**
+ * @brief Compute the CRC-32 of each flash sector in a range
+ * The range is copied into RAM_G with one CMD_FLASHREAD, then one CMD_MEMCRC
+ * is queued per sector and all results are read after a single flush, so the
+ * flash content does not cross the bus.
+ * dest_ram: scratch address in ram, FLASH_SECTOR_CRC_MAX * FLASH_SECTOR_SIZE bytes
+ * src_flash: source address in flash memory. Must be 4096-byte aligned
+ * num: number of bytes, at most FLASH_SECTOR_CRC_MAX * FLASH_SECTOR_SIZE. The last sector may be partial
+ * crc: one CRC-32 per sector, the same as a CRC-32 of the sector computed on the host
+ *
+ * @param phost Pointer to Hal context
+ * @param dest_ram Scratch on RAM_G
+ * @param src_flash Source in flash
+ * @param num Number of bytes to check
+ * @param crc Buffer to get the sector CRCs
+ * @return Flash_Cmd_Status_t
+ */
+Flash_Cmd_Status_t FlashHelper_SectorCrc(EVE_HalContext* phost, uint32_t dest_ram, uint32_t src_flash, uint32_t num, uint32_t *crc)
+{
+	uint16_t resAddr[FLASH_SECTOR_CRC_MAX];
+	uint32_t sectors = (num + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE;
+	uint32_t i;
+
+	if ((src_flash % FLASH_SECTOR_SIZE != 0) || ((dest_ram % 4) != 0) || (sectors > FLASH_SECTOR_CRC_MAX)) /* Check aligned address */
+	{
+		return FLASH_CMD_ALIGNED_ERR;
+	}
+
+	EVE_CoCmd_flashRead(phost, dest_ram, src_flash, (num + FLASH_READ_ALIGN_BYTE - 1) & ~(FLASH_READ_ALIGN_BYTE - 1));
+	for (i = 0; i < sectors; i++)
+	{
+		EVE_Cmd_startFunc(phost);
+		EVE_Cmd_wr32(phost, CMD_MEMCRC);
+		EVE_Cmd_wr32(phost, dest_ram + i * FLASH_SECTOR_SIZE);
+		EVE_Cmd_wr32(phost, min(FLASH_SECTOR_SIZE, num - i * FLASH_SECTOR_SIZE));
+		resAddr[i] = EVE_Cmd_moveWp(phost, 4);
+		EVE_Cmd_endFunc(phost);
+	}
+	if (!EVE_Cmd_waitFlush(phost))
+	{
+		return FLASH_CMD_FAULT_ERR;
+	}
+
+	for (i = 0; i < sectors; i++)
+	{
+		crc[i] = EVE_Hal_rd32(phost, RAM_CMD + resAddr[i]);
+	}
+	return FLASH_CMD_SUCCESS;
+}
+#endif
+
 #ifdef EVE_FLASH_AVAILABLE
 /**
  * @brief Erase entire flash
@@ -473,6 +525,8 @@ void App_Flush_DL_Buffer(const Gpu_Hal_Context_t* phost)
 #ifdef  BUFFER_OPTIMIZATION
 	if (DlBuffer_Index > 0)
 		EVE_Hal_wrMem(phost, RAM_DL, DlBuffer, DlBuffer_Index); /* Not legal on big endian CPU */
+#else
+	(void)phost;
 #endif
 	DlBuffer_Index = 0;
 }
@@ -38,8 +38,12 @@
 
 #include "Gpu_CoCmd.h"
 
+#define FLASH_SECTOR_SIZE 4096 /* Unit of CMD_FLASHUPDATE erases and of the delta update manifests */
+#define FLASH_SECTOR_CRC_MAX 16 /* Sectors checked by one FlashHelper_SectorCrc call */
+
 Flash_Cmd_Status_t FlashHelper_Update(EVE_HalContext *phost, uint32_t dest_flash, uint32_t src_ram, uint32_t num);
 Flash_Cmd_Status_t FlashHelper_Read(EVE_HalContext *phost, uint32_t dest_ram, uint32_t src_flash, uint32_t num, uint8_t *read_data);
+Flash_Cmd_Status_t FlashHelper_SectorCrc(EVE_HalContext *phost, uint32_t dest_ram, uint32_t src_flash, uint32_t num, uint32_t *crc);
 ft_void_t FlashHelper_Erase(EVE_HalContext *phost);
 uint8_t FlashHelper_GetState(EVE_HalContext *phost);
 ft_void_t FlashHelper_ClearCache(EVE_HalContext *phost);
@@ -0,0 +1,573 @@
+/**
+ * @file FontCache.c
+ * @brief Adaptive font cache sizing from CMD_FONTCACHEQUERY samples
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Platform.h"
+#include "EVE_CoCmd.h"
+
+#include "Common.h"
+#include "FontCache.h"
+
+#if (EVE_SUPPORT_CHIPID >= EVE_BT817)
+
+typedef struct FontCache_Font {
+	uint32_t handle;
+	uint32_t bytes;  /// Glyph bytes in use during its last sample
+	const char *const *warm; /// Strings to pre-warm the cache with
+	uint16_t warmCount;
+	uint8_t bound;   /// Bound with CMD_SETFONT2, the cache can be set up
+}FontCache_Font_t;
+
+static FontCache_Font_t s_fonts[FONTCACHE_FONT_MAX];
+static uint8_t s_count = 0;
+static uint8_t s_current = 0;   /// Font holding the cache
+static uint8_t s_trial = 0;     /// Fonts tried so far, the trial is over when it reaches s_count
+static uint8_t s_issued = 0;    /// CMD_FONTCACHE sent for the current font and block
+static uint8_t s_pending = 0;   /// CMD_FONTCACHE must be sent, waiting for a free block
+static uint8_t s_used = 0;      /// CMD_FONTCACHE was sent for s_addr, frames may draw glyphs from it
+static uint8_t s_idle = 0;      /// Mostly empty samples in a row
+static uint8_t s_query = 0;     /// CMD_FONTCACHEQUERY sent, its result is not read yet
+static uint8_t s_warming = 0;   /// The query checks the pre-warming
+static uint32_t s_addr = EVE_RAMG_NULL;
+static uint32_t s_size = 0;
+static uint32_t s_maxSize = 0;
+static uint32_t s_oldAddr = EVE_RAMG_NULL; /// Block the cache moved away from, freed once no frame on screen uses it
+static uint32_t s_oldFrame = 0; /// Frame in which the cache moved away from s_oldAddr
+static uint32_t s_result = EVE_RAMG_NULL; /// Copy of the CMD_FONTCACHEQUERY result
+static uint32_t s_queryFrame = 0;
+static uint32_t s_warmGlyphs = 0;
+static uint32_t s_frame = 0;
+static uint32_t s_lastUsed = 0;
+static uint32_t s_lastSample = 0;
+static FontCache_Stats_t s_stats;
+
+/**
+ * @brief Get the frame the commands written now belong to
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t Frame
+ */
+static uint32_t fontCacheFrame(EVE_HalContext *phost) {
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	return phost->CmdFrameSubmitted + 1;
+#else
+	(void)phost;
+	return s_frame;
+#endif
+}
+
+/**
+ * @brief Check if the coprocessor completed a frame
+ *
+ * @param phost Pointer to Hal context
+ * @param frame Frame returned by fontCacheFrame
+ * @return int 1 if the frame is completed
+ */
+static int fontCacheFrameDone(EVE_HalContext *phost, uint32_t frame) {
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	return EVE_Cmd_frameDone(phost, frame);
+#else
+	/// Each frame is flushed before the next one starts
+	(void)phost;
+	return (int32_t)(s_frame - frame) > 0;
+#endif
+}
+
+/**
+ * @brief Free the block the cache moved away from, once no frame on screen uses it
+ * The frame which moved the cache is on screen when the frame after it is completed.
+ *
+ * @param phost Pointer to Hal context
+ */
+static void fontCacheRetire(EVE_HalContext *phost) {
+	if (s_oldAddr != EVE_RAMG_NULL && fontCacheFrameDone(phost, s_oldFrame + 1)) {
+		EVE_RamG_free(phost, s_oldAddr);
+		s_oldAddr = EVE_RAMG_NULL;
+	}
+}
+
+/**
+ * @brief Send CMD_FONTCACHEQUERY without waiting for the result
+ * The result is copied to RAM_G right after the query, long before the host
+ * can fill the command buffer over it, and read once the frame is completed.
+ *
+ * @param phost Pointer to Hal context
+ */
+static void fontCacheQuery(EVE_HalContext *phost) {
+	uint16_t resAddr;
+
+	EVE_Cmd_framePresent(phost);
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_FONTCACHEQUERY);
+	resAddr = EVE_Cmd_moveWp(phost, 8);
+	EVE_Cmd_endFunc(phost);
+	EVE_CoCmd_memCpy(phost, s_result, RAM_CMD + resAddr, 4);
+	EVE_CoCmd_memCpy(phost, s_result + 4, RAM_CMD + ((resAddr + 4) & EVE_CMD_FIFO_MASK), 4);
+	s_query = 1;
+	s_queryFrame = fontCacheFrame(phost);
+}
+
+/**
+ * @brief Read the result of the last CMD_FONTCACHEQUERY, when its frame is completed
+ *
+ * @param phost Pointer to Hal context
+ * @param total Glyph bitmaps the cache holds
+ * @param used Glyph bitmaps in use
+ * @return int 1 if the result was read
+ */
+static int fontCacheResult(EVE_HalContext *phost, uint32_t *total, int32_t *used) {
+	if (!s_query || !fontCacheFrameDone(phost, s_queryFrame)) {
+		return 0;
+	}
+	s_query = 0;
+	*total = EVE_Hal_rd32(phost, s_result);
+	*used = (int32_t)EVE_Hal_rd32(phost, s_result + 4);
+	return 1;
+}
+
+/**
+ * @brief Draw the pre-warming strings of the current font, invisibly
+ * The coprocessor copies the glyphs into the cache while it builds the text.
+ * Color and tag writes are masked, so the frame being built is unchanged.
+ * Whether all the glyphs stayed in the cache is checked one frame later.
+ *
+ * @param phost Pointer to Hal context
+ */
+static void fontCacheWarm(EVE_HalContext *phost) {
+	FontCache_Font_t *font = &s_fonts[s_current];
+	uint8_t seen[128];
+	uint16_t i;
+	const char *c;
+
+	if (!font->warmCount) {
+		return;
+	}
+	memset(seen, 0, sizeof(seen));
+	s_warmGlyphs = 0;
+	EVE_Cmd_wr32(phost, SAVE_CONTEXT());
+	EVE_Cmd_wr32(phost, COLOR_MASK(0, 0, 0, 0));
+	EVE_Cmd_wr32(phost, TAG_MASK(0));
+	for (i = 0; i < font->warmCount; i++) {
+		EVE_CoCmd_text(phost, 0, 0, (int16_t)font->handle, 0, font->warm[i]);
+		/// Lower bound of the glyphs, characters outside ASCII are not counted
+		for (c = font->warm[i]; *c; c++) {
+			if ((uint8_t)*c > ' ' && (uint8_t)*c < 128 && !seen[(uint8_t)*c]) {
+				seen[(uint8_t)*c] = 1;
+				s_warmGlyphs++;
+			}
+		}
+	}
+	EVE_Cmd_wr32(phost, RESTORE_CONTEXT());
+	fontCacheQuery(phost);
+	s_warming = 1;
+}
+
+/**
+ * @brief Check the residency of the pre-warmed glyphs, a full cache may have dropped some again
+ *
+ * @param total Glyph bitmaps the cache holds
+ * @param used Glyph bitmaps in use
+ */
+static void fontCacheWarmed(uint32_t total, int32_t used) {
+	s_warming = 0;
+	if (used < 0) {
+		return;
+	}
+	s_stats.warmed += used;
+	s_lastUsed = used;
+	if ((uint32_t)used < s_warmGlyphs || (uint32_t)used >= total) {
+		s_stats.coldSets++;
+	}
+}
+
+/**
+ * @brief Get a block for the cache which no frame draws glyphs from
+ * CMD_FONTCACHE empties the block it is given, while the frame on screen may
+ * still draw glyphs from the current block. The cache then moves to a new
+ * block, and the current one is freed once the frame on screen no longer uses it.
+ *
+ * @param phost Pointer to Hal context
+ * @param size Size of the block
+ * @return int 1 if s_addr is such a block, of the given size
+ */
+static int fontCacheMove(EVE_HalContext *phost, uint32_t size) {
+	uint32_t addr;
+
+	if (!s_used && size == s_size) {
+		return 1;
+	}
+	if (s_oldAddr != EVE_RAMG_NULL) {
+		return 0; /// The previous block is still on screen
+	}
+	addr = EVE_RamG_alloc(phost, size, EVE_RAMG_ALIGN_FONTCACHE);
+	if (addr == EVE_RAMG_NULL) {
+		return 0;
+	}
+	if (s_used) {
+		s_oldAddr = s_addr;
+		s_oldFrame = fontCacheFrame(phost);
+	}
+	else {
+		EVE_RamG_free(phost, s_addr);
+	}
+	s_addr = addr;
+	s_size = size;
+	s_used = 0;
+	return 1;
+}
+
+/**
+ * @brief Point the coprocessor font cache at the current font
+ * The cache starts out empty, it is pre-warmed when strings were registered.
+ * Nothing is sent until the font is bound. When no block is free, this is
+ * retried on the next FontCache_Update.
+ *
+ * @param phost Pointer to Hal context
+ * @return int 1 if the cache is set up
+ */
+static int fontCacheIssue(EVE_HalContext *phost) {
+	FontCache_Font_t *font = &s_fonts[s_current];
+
+	s_issued = 0;
+	s_pending = 0;
+	if (s_addr == EVE_RAMG_NULL || !font->bound) {
+		return 0;
+	}
+	if (!fontCacheMove(phost, s_size)) {
+		s_pending = 1;
+		return 0;
+	}
+	EVE_Cmd_framePresent(phost);
+	EVE_CoCmd_fontCache(phost, font->handle, s_addr, s_size);
+	s_used = 1;
+	s_issued = 1;
+	s_query = 0; /// A pending result is about the previous cache
+	s_warming = 0;
+	s_lastUsed = 0;
+	fontCacheWarm(phost);
+	s_lastSample = EVE_millis(); /// The next sample covers a full period
+	s_stats.handle = font->handle;
+	s_stats.size = s_size;
+	return 1;
+}
+
+/**
+ * @brief Move the cache to a RAM_G block of another size
+ *
+ * @param phost Pointer to Hal context
+ * @param size Wanted size, clamped to the allowed range
+ * @return int 1 if the cache moved
+ */
+static int fontCacheResize(EVE_HalContext *phost, uint32_t size) {
+	size = min(max(ALIGN(size, EVE_RAMG_ALIGN_FONTCACHE), FONTCACHE_MIN_SIZE), s_maxSize);
+	if (size == s_size || !fontCacheMove(phost, size)) {
+		return 0;
+	}
+	s_stats.resizes++;
+	fontCacheIssue(phost);
+	return 1;
+}
+
+/**
+ * @brief Adapt the cache to a CMD_FONTCACHEQUERY sample
+ *
+ * @param phost Pointer to Hal context
+ * @param total Glyph bitmaps the cache holds
+ * @param used Glyph bitmaps in use
+ */
+static void fontCacheSample(EVE_HalContext *phost, uint32_t total, int32_t used) {
+	FontCache_Font_t *font;
+	uint32_t target = 0;
+	uint8_t full;
+	uint8_t i;
+
+	if (!total || used < 0) {
+		return;
+	}
+	s_stats.samples++;
+	s_stats.total = total;
+	s_stats.used = used;
+	if ((uint32_t)used > s_lastUsed) {
+		s_stats.misses += used - s_lastUsed;
+	}
+	s_lastUsed = used;
+	full = (uint32_t)used >= total;
+	if (full) {
+		s_stats.full++;
+	}
+	font = &s_fonts[s_current];
+	font->bytes = (uint32_t)(((uint64_t)used * s_size) / total);
+
+	if (s_trial < s_count) {
+		/// Trial, give each font the cache for one sample, then keep the one with the most glyph bytes in use
+		s_trial++;
+		if (s_trial < s_count) {
+			s_current = s_trial;
+			fontCacheIssue(phost);
+			return;
+		}
+		for (i = 0; i < s_count; i++) {
+			if (s_fonts[i].bytes > s_fonts[s_current].bytes) {
+				s_current = i;
+			}
+		}
+		if (!fontCacheResize(phost, s_fonts[s_current].bytes + s_fonts[s_current].bytes / 2)) {
+			fontCacheIssue(phost);
+		}
+		return;
+	}
+
+	if (full) {
+		/// Glyphs are fetched from flash again each frame, grow
+		s_idle = 0;
+		target = s_size * 2;
+	}
+	else if ((uint32_t)used * 4 < total) {
+		/// Mostly empty, shrink to twice the working set once it settled
+		if (++s_idle >= FONTCACHE_SHRINK_SAMPLES) {
+			s_idle = 0;
+			target = font->bytes * 2;
+		}
+	}
+	else {
+		s_idle = 0;
+	}
+	if (target) {
+		fontCacheResize(phost, target);
+	}
+}
+
+/**
+ * @brief Start adapting the font cache between fonts
+ * The cache starts as large as allowed, so the trial sees the whole working
+ * set of each font, and is fitted to the chosen font after the trial. It is
+ * at most half the largest free block, so it can move to a new block while
+ * the frame on screen still draws from the old one.
+ *
+ * @param phost Pointer to Hal context
+ * @param handles Font handles of extended fonts competing for the cache
+ * @param count Number of handles
+ * @param maxSize Largest cache allowed, in bytes
+ */
+void FontCache_Init(EVE_HalContext *phost, const uint32_t *handles, uint8_t count, uint32_t maxSize) {
+	EVE_RamGStats ramg;
+	uint8_t i;
+
+	FontCache_Release(phost);
+	memset(&s_stats, 0, sizeof(s_stats));
+	s_count = min(count, FONTCACHE_FONT_MAX);
+	for (i = 0; i < s_count; i++) {
+		s_fonts[i].handle = handles[i];
+		s_fonts[i].bytes = 0;
+		s_fonts[i].warm = NULL;
+		s_fonts[i].warmCount = 0;
+		s_fonts[i].bound = 0;
+	}
+	s_current = 0;
+	s_trial = 0;
+	s_idle = 0;
+
+	s_result = EVE_RamG_alloc(phost, 8, EVE_RAMG_ALIGN_DEFAULT);
+	EVE_RamG_stats(phost, &ramg);
+	s_maxSize = min(maxSize, ramg.LargestFree / 2 - min(ramg.LargestFree / 2, EVE_RAMG_ALIGN_FONTCACHE)); /// Room for the alignment
+	s_maxSize &= ~(EVE_RAMG_ALIGN_FONTCACHE - 1);
+	if (!s_count || s_result == EVE_RAMG_NULL || s_maxSize < FONTCACHE_MIN_SIZE) {
+		printf("Warning: RAMG free < 32Kb, no font cache\n");
+		FontCache_Release(phost);
+		return;
+	}
+	s_addr = EVE_RamG_alloc(phost, s_maxSize, EVE_RAMG_ALIGN_FONTCACHE);
+	if (s_addr == EVE_RAMG_NULL) {
+		printf("Warning: RAMG full, no font cache\n");
+		FontCache_Release(phost);
+		return;
+	}
+	s_size = s_maxSize;
+}
+
+/**
+ * @brief Give the font cache RAM_G back to the heap
+ *
+ * @param phost Pointer to Hal context
+ */
+void FontCache_Release(EVE_HalContext *phost) {
+	EVE_RamG_free(phost, s_addr);
+	EVE_RamG_free(phost, s_oldAddr);
+	EVE_RamG_free(phost, s_result);
+	s_addr = EVE_RAMG_NULL;
+	s_oldAddr = EVE_RAMG_NULL;
+	s_result = EVE_RAMG_NULL;
+	s_size = 0;
+	s_issued = 0;
+	s_pending = 0;
+	s_used = 0;
+	s_query = 0;
+	s_warming = 0;
+	s_count = 0;
+}
+
+/**
+ * @brief Tell that a font handle was bound with CMD_SETFONT2
+ * The cache is set up again when the handle holds it.
+ *
+ * @param phost Pointer to Hal context
+ * @param handle Font handle
+ */
+void FontCache_Bound(EVE_HalContext *phost, uint32_t handle) {
+	uint8_t i;
+
+	for (i = 0; i < s_count; i++) {
+		if (s_fonts[i].handle == handle) {
+			s_fonts[i].bound = 1;
+			if (i == s_current) {
+				fontCacheIssue(phost);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Register the strings a screen draws with a font, to pre-warm the cache
+ * The strings are drawn invisibly each time the font gets the cache, and at
+ * once when it has the cache now. List each character once where possible,
+ * for example "0123456789" for numbers. The strings must stay valid.
+ *
+ * @param phost Pointer to Hal context
+ * @param handle Font handle, registered with FontCache_Init
+ * @param strings Strings or character ranges
+ * @param count Number of strings
+ * @return int 1 if the font has the cache now and its glyphs are being loaded
+ */
+int FontCache_Prewarm(EVE_HalContext *phost, uint32_t handle, const char *const *strings, uint16_t count) {
+	uint8_t i;
+
+	for (i = 0; i < s_count; i++) {
+		if (s_fonts[i].handle == handle) {
+			s_fonts[i].warm = strings;
+			s_fonts[i].warmCount = count;
+			if (i == s_current && s_issued) {
+				/// Adds to the cache in place, the glyphs on screen stay
+				fontCacheWarm(phost);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Sample the font cache and adapt it, call once per frame
+ * Each sample is read one frame after its query, so no frame waits for the coprocessor.
+ *
+ * @param phost Pointer to Hal context
+ */
+void FontCache_Update(EVE_HalContext *phost) {
+	uint32_t total = 0;
+	int32_t used = 0;
+	uint32_t now = EVE_millis();
+
+	s_frame++;
+	fontCacheRetire(phost);
+	if (s_pending) {
+		fontCacheIssue(phost);
+		return;
+	}
+	if (!s_issued) {
+		return;
+	}
+	if (fontCacheResult(phost, &total, &used)) {
+		if (s_warming) {
+			fontCacheWarmed(total, used);
+		}
+		else {
+			fontCacheSample(phost, total, used);
+		}
+		return;
+	}
+	if (!s_query && now - s_lastSample >= FONTCACHE_SAMPLE_MS) {
+		s_lastSample = now;
+		fontCacheQuery(phost);
+	}
+}
+
+#else
+
+void FontCache_Init(EVE_HalContext *phost, const uint32_t *handles, uint8_t count, uint32_t maxSize) {
+	(void)phost;
+	(void)handles;
+	(void)count;
+	(void)maxSize;
+}
+
+void FontCache_Release(EVE_HalContext *phost) {
+	(void)phost;
+}
+
+void FontCache_Bound(EVE_HalContext *phost, uint32_t handle) {
+	(void)phost;
+	(void)handle;
+}
+
+void FontCache_Update(EVE_HalContext *phost) {
+	(void)phost;
+}
+
+int FontCache_Prewarm(EVE_HalContext *phost, uint32_t handle, const char *const *strings, uint16_t count) {
+	(void)phost;
+	(void)handle;
+	(void)strings;
+	(void)count;
+	return 0;
+}
+
+static FontCache_Stats_t s_stats;
+
+#endif
+
+/**
+ * @brief Get the font cache statistics since FontCache_Init
+ *
+ * @return const FontCache_Stats_t*
+ */
+const FontCache_Stats_t* FontCache_Get_Stats() {
+	return &s_stats;
+}
+
+/**
+ * @brief Print the font cache statistics since FontCache_Init
+ *
+ */
+void FontCache_Print_Stats() {
+	printf("Font cache: font %u, %u bytes, %u of %u glyphs used, %u misses, %u full of %u samples, %u resizes, %u glyphs pre-warmed, %u cold sets\n",
+		(unsigned)s_stats.handle, (unsigned)s_stats.size, (unsigned)s_stats.used, (unsigned)s_stats.total,
+		(unsigned)s_stats.misses, (unsigned)s_stats.full, (unsigned)s_stats.samples, (unsigned)s_stats.resizes,
+		(unsigned)s_stats.warmed, (unsigned)s_stats.coldSets);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file FontCache.h
+ * @brief Adaptive font cache sizing from CMD_FONTCACHEQUERY samples
+ *
+ * The BT817/8 coprocessor keeps one font cache, for one extended font at a
+ * time. CMD_FONTCACHEQUERY reports how many glyph bitmaps the cache holds and
+ * how many are in use. This module samples the query periodically:
+ * - during a trial, each registered font is cached for one sample period, and
+ *   the font with the most glyph bytes in use keeps the cache;
+ * - afterwards, the cache grows in the RAM_G heap while it is full, and
+ *   shrinks back to its working set, returning RAM_G to other consumers,
+ *   while it is mostly empty.
+ * The query results are read once their frame is completed, so no frame
+ * waits for the coprocessor. The cache never changes under the frame on
+ * screen: it moves to a new block, and the old block is freed once the
+ * frame on screen no longer draws from it.
+ *
+ * Glyphs which are not in the cache are fetched from flash again every frame.
+ * Call FontCache_Update once per frame, and FontCache_Bound each time a
+ * registered font handle was bound with CMD_SETFONT2.
+ *
+ * The strings a screen draws with a font can be registered with
+ * FontCache_Prewarm. They are drawn invisibly each time the font gets the
+ * cache, so the glyphs are in RAM_G before the first visible frame uses them.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef FONTCACHE_H_
+#define FONTCACHE_H_
+
+#include "EVE_Platform.h"
+
+#define FONTCACHE_FONT_MAX        4           /// Fonts competing for the cache
+#define FONTCACHE_MIN_SIZE        (16 * 1024) /// Smallest cache CMD_FONTCACHE accepts
+#define FONTCACHE_SAMPLE_MS       1000        /// Period of CMD_FONTCACHEQUERY, each result is read one frame later
+#define FONTCACHE_SHRINK_SAMPLES  4           /// Samples mostly empty in a row before the cache shrinks
+
+typedef struct FontCache_Stats {
+	uint32_t samples;  /// CMD_FONTCACHEQUERY samples taken
+	uint32_t total;    /// Glyph bitmaps the cache holds, last sample
+	uint32_t used;     /// Glyph bitmaps in use, last sample
+	uint32_t misses;   /// Glyphs fetched from flash into the cache, the growth of the used count
+	uint32_t full;     /// Samples with a full cache, glyphs are then fetched from flash again each frame
+	uint32_t resizes;  /// Cache moves to a new RAM_G block
+	uint32_t warmed;   /// Glyphs loaded into the cache by pre-warming, not counted as misses
+	uint32_t coldSets; /// Pre-warming runs which could not keep all their glyphs in the cache
+	uint32_t handle;   /// Font handle holding the cache
+	uint32_t size;     /// Bytes of RAM_G the cache takes
+}FontCache_Stats_t;
+
+void FontCache_Init(EVE_HalContext *phost, const uint32_t *handles, uint8_t count, uint32_t maxSize);
+void FontCache_Release(EVE_HalContext *phost);
+void FontCache_Bound(EVE_HalContext *phost, uint32_t handle);
+void FontCache_Update(EVE_HalContext *phost);
+int FontCache_Prewarm(EVE_HalContext *phost, uint32_t handle, const char *const *strings, uint16_t count);
+
+const FontCache_Stats_t* FontCache_Get_Stats();
+void FontCache_Print_Stats();
+
+#endif /* FONTCACHE_H_ */
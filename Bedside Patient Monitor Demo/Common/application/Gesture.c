@@ -441,9 +441,24 @@ Gesture_Touch_t* utils_gestureRenew(EVE_HalContext* phost)
 #else
 #define EVE_XY_RESET EVE1_XY_RESET
 #endif
-	uint32_t reg_touch_tag = EVE_Hal_rd32(phost, REG_TOUCH_TAG);
-	uint32_t reg_track = EVE_Hal_rd32(phost, REG_TRACKER);
-	uint32_t reg_touch_screen_xy = EVE_Hal_rd32(phost, REG_TOUCH_SCREEN_XY);
+	static const uint32_t regs[] = {
+		REG_TOUCH_TAG,
+		REG_TRACKER,
+		REG_TOUCH_SCREEN_XY,
+#if ENABLE_5_FINGER
+		REG_CTOUCH_TOUCH0_XY,
+		REG_CTOUCH_TOUCHA_XY,
+		REG_CTOUCH_TOUCHB_XY,
+		REG_CTOUCH_TOUCHC_XY,
+		REG_CTOUCH_TOUCHC_XY,
+#endif
+	};
+	uint32_t values[sizeof(regs) / sizeof(regs[0])];
+	EVE_Hal_rdRegs(phost, regs, values, sizeof(regs) / sizeof(regs[0]));
+
+	uint32_t reg_touch_tag = values[0];
+	uint32_t reg_track = values[1];
+	uint32_t reg_touch_screen_xy = values[2];
 
 	uint32_t rawX = reg_touch_screen_xy >> 16;
 	uint32_t rawY = reg_touch_screen_xy & 0x0000FFFF;
@@ -489,17 +504,9 @@ Gesture_Touch_t* utils_gestureRenew(EVE_HalContext* phost)
 	measure_traveled();
 
 #if ENABLE_5_FINGER
-	uint32_t reg_touch_xy[] = {
-		REG_CTOUCH_TOUCH0_XY,
-		REG_CTOUCH_TOUCHA_XY,
-		REG_CTOUCH_TOUCHB_XY,
-		REG_CTOUCH_TOUCHC_XY,
-		REG_CTOUCH_TOUCHC_XY,
-	};
-
 	for (int i = 0; i < MAX_FINGER; i++)
 	{
-		uint32_t touch_xy = EVE_Hal_rd32(phost, reg_touch_xy[i]);
+		uint32_t touch_xy = values[3 + i];
 		sGesture.finger[i].touchX = touch_xy >> 16;
 		sGesture.finger[i].touchY = touch_xy & 0x0000FFFF;
 	}
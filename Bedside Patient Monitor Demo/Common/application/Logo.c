@@ -68,8 +68,7 @@ void Logo_Showup(EVE_HalContext *phost)
     float scale = 1;
 
 #if defined(MSVC_PLATFORM) || defined(BT8XXEMU_PLATFORM)
-    EVE_Cmd_wr32(phost,CMD_INFLATE);
-    EVE_Cmd_wr32(phost,0);
+    EVE_CoCmd_inflate(phost, 0);
     EVE_Cmd_wrMem(phost, logo, sizeof(logo));
 #else
     EVE_CoCmd_inflate(phost, 0);
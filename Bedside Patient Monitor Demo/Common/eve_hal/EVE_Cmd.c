@@ -52,6 +52,63 @@ static inline void endFunc(EVE_HalContext *phost)
 	}
 }
 
+#if EVE_CMD_DEFER
+/**
+ * @brief Commit staged commands before reading back coprocessor state
+ *
+ * @param phost Pointer to Hal context
+ */
+static inline void commitDeferred(EVE_HalContext *phost)
+{
+	if (phost->CmdDeferIndex && !phost->CmdWaiting)
+		EVE_Cmd_commit(phost);
+}
+#else
+#define commitDeferred(phost) eve_noop()
+#endif
+
+#if EVE_CMD_FRAME_SKIP
+/* FNV-1a, applied to whole words where possible */
+#define EVE_CMD_FRAME_HASH_BASIS 2166136261UL
+#define EVE_CMD_FRAME_HASH_PRIME 16777619UL
+
+/**
+ * @brief Add a command word to the hash of the current frame
+ *
+ * @param phost Pointer to Hal context
+ * @param value Command word
+ */
+static inline void hashWord(EVE_HalContext *phost, uint32_t value)
+{
+	phost->CmdFrameHash = (phost->CmdFrameHash ^ value) * EVE_CMD_FRAME_HASH_PRIME;
+}
+
+/**
+ * @brief Add a buffer to the hash of the current frame
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data pointer
+ * @param size Size of the data
+ */
+static void hashMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+	uint32_t hash = phost->CmdFrameHash;
+	uint32_t i;
+	for (i = 0; i + 4 <= size; i += 4)
+	{
+		uint32_t value;
+		memcpy(&value, &buffer[i], 4);
+		hash = (hash ^ value) * EVE_CMD_FRAME_HASH_PRIME;
+	}
+	for (; i < size; ++i)
+		hash = (hash ^ buffer[i]) * EVE_CMD_FRAME_HASH_PRIME;
+	phost->CmdFrameHash = hash;
+}
+#else
+#define hashWord(phost, value) eve_noop()
+#define hashMem(phost, buffer, size) eve_noop()
+#endif
+
 /**
  * @brief Read from Coprocessor
  *
@@ -61,10 +118,14 @@ static inline void endFunc(EVE_HalContext *phost)
 uint16_t EVE_Cmd_rp(EVE_HalContext *phost)
 {
 	uint16_t rp;
+	commitDeferred(phost);
 	endFunc(phost);
 	rp = EVE_Hal_rd16(phost, REG_CMD_READ) & EVE_CMD_FIFO_MASK;
-	if (EVE_CMD_FAULT(rp))
+	if (EVE_CMD_FAULT(rp) && !phost->CmdFault)
+	{
 		phost->CmdFault = true;
+		++phost->Stats.CmdFaults;
+	}
 	return rp;
 }
 
@@ -76,6 +137,7 @@ uint16_t EVE_Cmd_rp(EVE_HalContext *phost)
  */
 uint16_t EVE_Cmd_wp(EVE_HalContext *phost)
 {
+	commitDeferred(phost);
 	endFunc(phost);
 #if defined(EVE_SUPPORT_CMDB)
 	return EVE_Hal_rd16(phost, REG_CMD_WRITE) & EVE_CMD_FIFO_MASK;
@@ -96,20 +158,54 @@ uint16_t EVE_Cmd_space(EVE_HalContext *phost)
 	uint16_t space;
 	uint16_t wp;
 	uint16_t rp;
+	commitDeferred(phost);
 	endFunc(phost);
+	++phost->Stats.CmdSpaceReads;
 #if defined(EVE_SUPPORT_CMDB)
 	space = EVE_Hal_rd16(phost, REG_CMDB_SPACE) & EVE_CMD_FIFO_MASK;
-	if (EVE_CMD_FAULT(space))
+	if (EVE_CMD_FAULT(space) && !phost->CmdFault)
+	{
 		phost->CmdFault = true;
-	phost->CmdSpace = space;
-	return space;
+		++phost->Stats.CmdFaults;
+	}
 #else
 	wp = EVE_Cmd_wp(phost);
 	rp = EVE_Cmd_rp(phost);
 	space = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
+#endif
 	phost->CmdSpace = space;
+	phost->CmdSpaceLow = space < phost->CmdSpaceLowWater;
 	return space;
-#endif
+}
+
+/**
+ * @brief Set the low-water mark of the tracked free space
+ * Between commands, the free space is read from the device again, without
+ * waiting, once the tracked space drops below the mark. It is not read
+ * again until a write does not fit when the last read was already below
+ * the mark, so a busy coprocessor does not cause a read for every write.
+ *
+ * @param phost Pointer to Hal context
+ * @param lowWater Mark in bytes, 0 to only read the space when a write does not fit
+ */
+void EVE_Cmd_setSpaceLowWater(EVE_HalContext *phost, uint16_t lowWater)
+{
+	phost->CmdSpaceLowWater = lowWater;
+	phost->CmdSpaceLow = false;
+}
+
+/**
+ * @brief Check if the free space must be read before writing
+ *
+ * @param phost Pointer to Hal context
+ * @param size Size to write
+ * @return true If the tracked space is too small for the write, or below the low-water mark
+ */
+static inline bool needSpace(EVE_HalContext *phost, uint32_t size)
+{
+	uint16_t space = phost->CmdSpace;
+	return space < size
+	    || (space < phost->CmdSpaceLowWater && !phost->CmdSpaceLow && !phost->CmdFunc);
 }
 
 /**
@@ -177,7 +273,7 @@ static uint32_t wrBuffer(EVE_HalContext *phost, const void *buffer, uint32_t siz
 		uint32_t space = phost->CmdSpace;
 		uint32_t req = min((string ? (transfer + 1) : transfer), (EVE_CMD_FIFO_SIZE >> 1));
 		eve_assert(!string || (req == (transfer + 1)));
-		if (space < req)
+		if (needSpace(phost, req))
 		{
 			if (!EVE_Cmd_waitSpace(phost, req))
 				return transfered; /* Coprocessor fault */
@@ -217,6 +313,7 @@ static uint32_t wrBuffer(EVE_HalContext *phost, const void *buffer, uint32_t siz
 			}
 			eve_assert(phost->CmdSpace >= transfer);
 			phost->CmdSpace -= (uint16_t)transfer;
+			phost->Stats.CmdBytes += transfer;
 #if !defined(EVE_SUPPORT_CMDB)
 			phost->CmdWp += (uint16_t)transfer;
 			phost->CmdWp &= EVE_CMD_FIFO_MASK;
@@ -230,6 +327,138 @@ static uint32_t wrBuffer(EVE_HalContext *phost, const void *buffer, uint32_t siz
 	return transfered;
 }
 
+#if EVE_CMD_DEFER
+/**
+ * @brief Make room in the host-side command buffer, committing whole commands only
+ *
+ * While a function is written, only the commands staged before it are
+ * committed, and the part of the function staged so far is moved to the
+ * start of the buffer. A command never ends up split over two commits,
+ * unless it is larger than the buffer.
+ *
+ * @param phost Pointer to Hal context
+ * @param size Bytes to make room for
+ * @return true True if ok
+ * @return false False if coprocessor fault
+ */
+static bool deferReserve(EVE_HalContext *phost, uint32_t size)
+{
+	uint32_t start;
+	uint32_t partial;
+	if (phost->CmdDeferIndex + size <= EVE_CMD_DEFER_SIZE)
+		return true;
+
+	start = phost->CmdFuncDeferIndex;
+	partial = phost->CmdDeferIndex - start;
+	if (!phost->CmdFunc || partial + size > EVE_CMD_DEFER_SIZE)
+		return EVE_Cmd_commit(phost); /* No complete command to commit separately */
+
+	phost->CmdDeferIndex = start;
+	if (!EVE_Cmd_commit(phost))
+		return false;
+	memmove(phost->CmdDeferBuffer, &phost->CmdDeferBuffer[start], partial);
+	phost->CmdDeferIndex = partial;
+	return true;
+}
+
+/**
+ * @brief Stage a buffer in the host-side command buffer, padded to 4 bytes
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data pointer
+ * @param size Size to write
+ * @return true True if ok
+ * @return false False if coprocessor fault
+ */
+static bool deferBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+	uint32_t transfer = (size + 3) & ~0x3UL;
+	if (phost->CmdDeferIndex + transfer > EVE_CMD_DEFER_SIZE)
+	{
+		if (!deferReserve(phost, transfer))
+			return false;
+		if (phost->CmdDeferIndex + transfer > EVE_CMD_DEFER_SIZE)
+		{
+			if (!EVE_Cmd_commit(phost))
+				return false;
+			/* Too large to stage, write directly */
+#if EVE_CMD_FRAME_SKIP
+			phost->CmdFrameCommitted = true;
+#endif
+			return wrBuffer(phost, buffer, size, false, false) == size;
+		}
+	}
+	memcpy(&phost->CmdDeferBuffer[phost->CmdDeferIndex], buffer, size);
+	memset(&phost->CmdDeferBuffer[phost->CmdDeferIndex + size], 0, transfer - size);
+	phost->CmdDeferIndex += transfer;
+	return true;
+}
+
+/**
+ * @brief Stage a string in the host-side command buffer, null terminated and padded to 4 bytes
+ *
+ * @param phost Pointer to Hal context
+ * @param str String to write
+ * @param maxLength Length to write, up to EVE_CMD_STRING_MAX
+ * @return uint32_t Number of bytes staged
+ */
+static uint32_t deferString(EVE_HalContext *phost, const char *str, uint32_t maxLength)
+{
+	uint32_t length;
+	uint32_t transfer;
+	if (!maxLength)
+		return 0;
+	eve_assert(maxLength <= EVE_CMD_STRING_MAX);
+	length = (uint32_t)strnlen(str, maxLength);
+	transfer = (length + 4) & ~0x3UL;
+	if (!deferReserve(phost, transfer))
+		return 0;
+	memcpy(&phost->CmdDeferBuffer[phost->CmdDeferIndex], str, length);
+	memset(&phost->CmdDeferBuffer[phost->CmdDeferIndex + length], 0, transfer - length);
+	phost->CmdDeferIndex += transfer;
+	return transfer;
+}
+
+/**
+ * @brief Write all staged commands to Coprocessor's command fifo
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if ok
+ * @return false False if coprocessor fault
+ */
+bool EVE_Cmd_commit(EVE_HalContext *phost)
+{
+	uint32_t size = phost->CmdDeferIndex;
+	if (!size)
+		return true;
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+#if EVE_CMD_FRAME_SKIP
+	phost->CmdFrameCommitted = true;
+#endif
+
+	/* Reset first, wrBuffer may call back into functions which commit */
+	phost->CmdDeferIndex = 0;
+	phost->CmdFuncDeferIndex = 0;
+	return wrBuffer(phost, phost->CmdDeferBuffer, size, false, false) == size;
+}
+
+/**
+ * @brief Enable or disable staging of commands in host memory
+ *
+ * @param phost Pointer to Hal context
+ * @param defer True to stage commands, false to write directly
+ */
+void EVE_Cmd_setDefer(EVE_HalContext *phost, bool defer)
+{
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+	if (!defer)
+		EVE_Cmd_commit(phost);
+	phost->CmdDefer = defer;
+}
+#endif
+
 /**
  * @brief Begin writing a function, keeps the transfer open
  *
@@ -240,6 +469,9 @@ void EVE_Cmd_startFunc(EVE_HalContext *phost)
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
 	phost->CmdFunc = true;
+#if EVE_CMD_DEFER
+	phost->CmdFuncDeferIndex = phost->CmdDeferIndex;
+#endif
 }
 
 /**
@@ -268,6 +500,11 @@ bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
 {
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+	hashMem(phost, buffer, size);
+#if EVE_CMD_DEFER
+	if (phost->CmdDefer)
+		return deferBuffer(phost, buffer, size);
+#endif
 	return wrBuffer(phost, buffer, size, false, false) == size;
 }
 
@@ -284,6 +521,11 @@ bool EVE_Cmd_wrProgMem(EVE_HalContext *phost, eve_progmem_const uint8_t *buffer,
 {
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+	/* Program memory does not change, its address identifies the content */
+	hashWord(phost, (uint32_t)(uintptr_t)buffer);
+	hashWord(phost, size);
+	if (!EVE_Cmd_commit(phost)) /* Program memory is written directly */
+		return false;
 	return wrBuffer(phost, (void *)(uintptr_t)buffer, size, true, false) == size;
 }
 
@@ -300,6 +542,14 @@ uint32_t EVE_Cmd_wrString(EVE_HalContext *phost, const char *str, uint32_t maxLe
 	uint32_t transfered;
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+#if EVE_CMD_FRAME_SKIP
+	hashMem(phost, (const uint8_t *)str, (uint32_t)strnlen(str, maxLength));
+	hashWord(phost, 0);
+#endif
+#if EVE_CMD_DEFER
+	if (phost->CmdDefer)
+		return deferString(phost, str, maxLength);
+#endif
 	transfered = wrBuffer(phost, str, maxLength, false, true);
 	return transfered;
 }
@@ -372,7 +622,30 @@ bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
 
-	if (phost->CmdSpace < 4 && !EVE_Cmd_waitSpace(phost, 4))
+#if EVE_DL_FILTER
+	/* Words written within a function are command parameters */
+	if (!phost->CmdFunc && EVE_CoDlImpl_filter(phost, value))
+		return true;
+#endif
+	hashWord(phost, value);
+
+#if EVE_CMD_DEFER
+	if (phost->CmdDefer)
+	{
+		uint8_t *dst;
+		if (!deferReserve(phost, 4))
+			return false;
+		dst = &phost->CmdDeferBuffer[phost->CmdDeferIndex];
+		dst[0] = value & 0xFF;
+		dst[1] = (value >> 8) & 0xFF;
+		dst[2] = (value >> 16) & 0xFF;
+		dst[3] = value >> 24;
+		phost->CmdDeferIndex += 4;
+		return true;
+	}
+#endif
+
+	if (needSpace(phost, 4) && !EVE_Cmd_waitSpace(phost, 4))
 		return false;
 
 	if (phost->Status != EVE_STATUS_WRITING)
@@ -390,6 +663,7 @@ bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
 	}
 	eve_assert(phost->CmdSpace >= 4);
 	phost->CmdSpace -= 4;
+	phost->Stats.CmdBytes += 4;
 #if !defined(EVE_SUPPORT_CMDB)
 	phost->CmdWp += 4;
 	phost->CmdWp &= EVE_CMD_FIFO_MASK;
@@ -416,6 +690,8 @@ uint16_t EVE_Cmd_moveWp(EVE_HalContext *phost, uint16_t bytes)
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
 
+	if (!EVE_Cmd_commit(phost))
+		return -1;
 	if (!EVE_Cmd_waitSpace(phost, bytes))
 		return -1;
 
@@ -519,21 +795,30 @@ bool EVE_Cmd_waitFlush(EVE_HalContext *phost)
 {
 	uint16_t rp;
 	uint16_t wp;
+	uint32_t start;
 
 	eve_assert(!phost->CmdWaiting);
+	if (!EVE_Cmd_commit(phost))
+		return false;
 	phost->CmdWaiting = true;
+	start = EVE_millis();
 	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
 	{
 		if (!handleWait(phost, rp))
 		{
 			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
+			phost->Stats.WaitFlushMillis += EVE_millis() - start;
 			return false;
 		}
 	}
 
 	/* Command buffer empty */
+	phost->Stats.WaitFlushMillis += EVE_millis() - start;
 	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
 	phost->CmdWaiting = false;
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	phost->CmdFrameDone = phost->CmdFrameSubmitted;
+#endif
 	return true;
 }
 
@@ -551,26 +836,35 @@ uint32_t EVE_Cmd_waitSpace(EVE_HalContext *phost, uint32_t size)
 	}
 
 	eve_assert(!phost->CmdWaiting);
+	if (!EVE_Cmd_commit(phost))
+		return 0;
 	phost->CmdWaiting = true;
 
 	space = phost->CmdSpace;
 
-#if 1
-	/* Optimization.
-	Only update space if more space is needed than already known available,
-	or when not actually waiting for any space */
-	if (space < size || !size)
+	/* The free space is tracked locally, each write subtracts from it.
+	Only read it from the device when a request needs more than is known
+	to be free, when the tracked space dropped below the low-water mark,
+	or when not actually waiting for any space. Only wait for the request */
+	if (space < size || !size || (space < phost->CmdSpaceLowWater && !phost->CmdSpaceLow))
 		space = EVE_Cmd_space(phost);
 	if (!checkWait(phost, space))
 		return 0;
-#endif
 
 	/* Wait until there's sufficient space */
-	while (space < size)
+	if (space < size)
 	{
-		space = EVE_Cmd_space(phost);
-		if (!handleWait(phost, space))
-			return 0;
+		uint32_t start = EVE_millis();
+		while (space < size)
+		{
+			space = EVE_Cmd_space(phost);
+			if (!handleWait(phost, space))
+			{
+				phost->Stats.WaitSpaceMillis += EVE_millis() - start;
+				return 0;
+			}
+		}
+		phost->Stats.WaitSpaceMillis += EVE_millis() - start;
 	}
 
 	/* Sufficient space */
@@ -591,6 +885,8 @@ bool EVE_Cmd_waitLogo(EVE_HalContext *phost)
 	uint16_t wp;
 
 	eve_assert(!phost->CmdWaiting);
+	if (!EVE_Cmd_commit(phost))
+		return false;
 	phost->CmdWaiting = true;
 
 	do
@@ -617,6 +913,8 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value)
 	uint16_t wp;
 
 	eve_assert(!phost->CmdWaiting);
+	if (!EVE_Cmd_commit(phost))
+		return false;
 	phost->CmdWaiting = true;
 	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
 	{
@@ -639,6 +937,198 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value)
 	return EVE_Hal_rd32(phost, ptr) == value;
 }
 
+#if EVE_CMD_FRAMES_IN_FLIGHT
+/**
+ * @brief Submit the current frame, only waits when too many frames are pending
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t Sequence number of the submitted frame
+ */
+uint32_t EVE_Cmd_submitFrame(EVE_HalContext *phost)
+{
+	uint32_t seq;
+
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+
+	if (!phost->CmdFrameSubmitted)
+	{
+		/* First frame, no fence is pending yet */
+		EVE_Hal_wr32(phost, EVE_CMD_FENCE_ADDR, 0);
+		phost->CmdFrameDone = 0;
+	}
+
+	seq = phost->CmdFrameSubmitted + 1;
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_MEMWRITE);
+	EVE_Cmd_wr32(phost, EVE_CMD_FENCE_ADDR);
+	EVE_Cmd_wr32(phost, 4);
+	EVE_Cmd_wr32(phost, seq);
+	EVE_Cmd_endFunc(phost);
+	phost->CmdFrameSubmitted = seq;
+
+	/* Start the coprocessor on the frame */
+	EVE_Cmd_commit(phost);
+
+	if (seq - phost->CmdFrameDone > EVE_CMD_FRAMES_IN_FLIGHT)
+		EVE_Cmd_waitFrame(phost, seq - EVE_CMD_FRAMES_IN_FLIGHT);
+
+	return seq;
+}
+
+/**
+ * @brief Check if a submitted frame has been completed
+ *
+ * @param phost Pointer to Hal context
+ * @param seq Sequence number returned by EVE_Cmd_submitFrame
+ * @return true True if the frame is completed
+ * @return false False if the frame is still pending
+ */
+bool EVE_Cmd_frameDone(EVE_HalContext *phost, uint32_t seq)
+{
+	uint32_t fence;
+
+	if ((int32_t)(phost->CmdFrameDone - seq) >= 0)
+		return true;
+
+	fence = EVE_Hal_rd32(phost, EVE_CMD_FENCE_ADDR);
+	if ((int32_t)(fence - phost->CmdFrameDone) > 0)
+		phost->CmdFrameDone = fence;
+	return (int32_t)(phost->CmdFrameDone - seq) >= 0;
+}
+
+/**
+ * @brief Wait till a submitted frame has been completed
+ *
+ * @param phost Pointer to Hal context
+ * @param seq Sequence number returned by EVE_Cmd_submitFrame
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Cmd_waitFrame(EVE_HalContext *phost, uint32_t seq)
+{
+	uint16_t rp;
+	uint16_t wp;
+	uint32_t start;
+
+	eve_assert(!phost->CmdWaiting);
+	if (!EVE_Cmd_commit(phost))
+		return false;
+	phost->CmdWaiting = true;
+	start = EVE_millis();
+	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
+	{
+		if (EVE_Cmd_frameDone(phost, seq))
+		{
+			phost->Stats.WaitFlushMillis += EVE_millis() - start;
+			phost->CmdWaiting = false;
+			return true;
+		}
+		if (!handleWait(phost, rp))
+		{
+			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
+			phost->Stats.WaitFlushMillis += EVE_millis() - start;
+			return false;
+		}
+	}
+
+	/* Command buffer empty, all submitted frames are completed */
+	phost->Stats.WaitFlushMillis += EVE_millis() - start;
+	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
+	phost->CmdWaiting = false;
+	phost->CmdFrameDone = phost->CmdFrameSubmitted;
+	return true;
+}
+#endif
+
+#if EVE_CMD_FRAME_SKIP
+/**
+ * @brief Enable or disable skipping frames that are identical to the last presented frame
+ *
+ * @param phost Pointer to Hal context
+ * @param skip True to skip identical frames
+ * @param refreshMillis Present an identical frame anyway after this time, 0 to never present it
+ */
+void EVE_Cmd_setFrameSkip(EVE_HalContext *phost, bool skip, uint32_t refreshMillis)
+{
+	phost->CmdFrameSkip = skip;
+	phost->CmdFrameRefreshMillis = refreshMillis;
+	phost->CmdFramePresent = true; /* The frame on screen is not known */
+}
+
+/**
+ * @brief Start hashing the commands of a frame
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Cmd_frameBegin(EVE_HalContext *phost)
+{
+	eve_assert(phost->CmdBufferIndex == 0);
+	phost->CmdFrameHash = EVE_CMD_FRAME_HASH_BASIS;
+#if EVE_CMD_DEFER
+	phost->CmdFrameDeferIndex = phost->CmdDeferIndex;
+	phost->CmdFrameCommitted = false;
+#endif
+}
+
+/**
+ * @brief Check if the frame must be presented
+ *
+ * @param phost Pointer to Hal context
+ * @return true If DISPLAY and CMD_SWAP must be sent
+ * @return false If the frame is identical to the last presented frame, and was dropped
+ */
+bool EVE_Cmd_frameEnd(EVE_HalContext *phost)
+{
+	uint32_t now;
+	eve_assert(phost->CmdBufferIndex == 0);
+	if (!phost->CmdFrameSkip)
+		return true;
+
+	now = EVE_millis();
+	if (!phost->CmdFramePresent && phost->CmdFrameHash == phost->CmdFramePresentedHash
+#if EVE_CMD_DEFER
+	    /* Once part of the frame was committed, the staged rest may complete a command the coprocessor already started */
+	    && !phost->CmdFrameCommitted
+#endif
+	    && (!phost->CmdFrameRefreshMillis || (now - phost->CmdFramePresentedMillis) < phost->CmdFrameRefreshMillis))
+	{
+#if EVE_CMD_DEFER
+		/* Drop whatever of the frame is still staged. Without staging the commands
+		were written directly, the coprocessor built the display list but it is
+		never swapped in, so the screen stays on the presented frame */
+		phost->CmdDeferIndex = phost->CmdFrameDeferIndex;
+#endif
+		++phost->Stats.FramesSkipped;
+		return false;
+	}
+
+	phost->CmdFramePresentedHash = phost->CmdFrameHash;
+	phost->CmdFramePresentedMillis = now;
+	phost->CmdFramePresent = false;
+	phost->CmdFrameChecked = true;
+	return true;
+}
+
+/**
+ * @brief Wait until the display scanned out the next frame
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Cmd_frameWait(EVE_HalContext *phost)
+{
+	uint32_t frames = EVE_Hal_rd32(phost, REG_FRAMES);
+	uint32_t start = EVE_millis();
+
+	/* REG_FRAMES does not advance while the display is disabled */
+	while (EVE_Hal_rd32(phost, REG_FRAMES) == frames
+	    && (EVE_millis() - start) < EVE_CMD_FRAME_WAIT_MAX)
+	{
+		EVE_sleep(1);
+	}
+}
+#endif
+
 /** Restore the internal state of EVE_Cmd.
  * Call this after manually writing to the coprocessor buffer
  */
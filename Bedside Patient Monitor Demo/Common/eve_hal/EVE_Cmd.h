@@ -57,6 +57,12 @@ Updates cached available space.
 Safe to use during ongoing command transaction */
 uint16_t EVE_Cmd_space(EVE_HalContext *phost);
 
+/** Set the low-water mark of the tracked available space.
+Between commands, the space is read again without waiting once the
+tracked value drops below the mark. 0 to only read it when a write does
+not fit. Defaults to EVE_CMD_SPACE_LOW_WATER */
+void EVE_Cmd_setSpaceLowWater(EVE_HalContext *phost, uint16_t lowWater);
+
 /* Begin writing a function, keeps the transfer open. */
 /** @note While a command transaction is ongoing,
     HAL functions outside of EVE_Cmd_* must not be used. */
@@ -67,6 +73,9 @@ void EVE_Cmd_endFunc(EVE_HalContext *phost);
 
 /** Write a buffer to the command buffer.
 Waits if there is not enough space in the command buffer.
+The buffer is not seen by EVE_DL_FILTER. Display list words in it that change
+the display list state must be written with EVE_Cmd_wr32 instead, or the filter
+may drop a later word that restores the state.
 Returns false in case a coprocessor fault occurred */
 bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size);
 
@@ -125,6 +134,75 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value);
 Call this after manually writing the the coprocessor buffer */
 void EVE_Cmd_restore(EVE_HalContext *phost);
 
+#if EVE_CMD_DEFER
+/** Enable or disable deferred commit.
+While enabled, commands are staged in host memory and only written
+to the coprocessor when the staging buffer is full, when waiting for
+the coprocessor, or when reading back any coprocessor state.
+Disabling commits any staged commands */
+void EVE_Cmd_setDefer(EVE_HalContext *phost, bool defer);
+
+/** Write all staged commands to the coprocessor, in as few bursts as
+the available space allows. Does not wait for the commands to execute.
+Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_commit(EVE_HalContext *phost);
+#else
+static inline bool EVE_Cmd_commit(EVE_HalContext *phost)
+{
+	(void)phost;
+	return true;
+}
+#endif
+
+#if EVE_CMD_FRAMES_IN_FLIGHT
+/** Submit the current frame without waiting for the coprocessor.
+Call after CMD_SWAP. Writes a fence into RAM_G at `EVE_CMD_FENCE_ADDR` and
+commits any staged commands. Only waits when `EVE_CMD_FRAMES_IN_FLIGHT`
+frames are already pending. Returns the sequence number of the frame */
+uint32_t EVE_Cmd_submitFrame(EVE_HalContext *phost);
+
+/** Check if the coprocessor has completed the frame with the specified
+sequence number. Does not wait */
+bool EVE_Cmd_frameDone(EVE_HalContext *phost, uint32_t seq);
+
+/** Wait for the coprocessor to complete the frame with the specified
+sequence number. Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_waitFrame(EVE_HalContext *phost, uint32_t seq);
+#endif
+
+#if EVE_CMD_FRAME_SKIP
+/** Enable or disable skipping frames that are identical to the last presented frame.
+An identical frame is still presented once `refreshMillis` passed since the last
+presented frame, 0 to never present identical frames */
+void EVE_Cmd_setFrameSkip(EVE_HalContext *phost, bool skip, uint32_t refreshMillis);
+
+/** Start hashing the commands of a frame. Call before CMD_DLSTART */
+void EVE_Cmd_frameBegin(EVE_HalContext *phost);
+
+/** Check the commands of the frame before DISPLAY and CMD_SWAP.
+Returns false when the frame is identical to the last presented frame.
+The commands of the frame which are still staged are then dropped,
+and DISPLAY and CMD_SWAP must not be sent. The frame must not contain
+commands with side effects beyond building the display list,
+or call EVE_Cmd_framePresent */
+bool EVE_Cmd_frameEnd(EVE_HalContext *phost);
+
+/** Wait until the display scanned out the next frame, for loops which
+dropped a frame in EVE_Cmd_frameEnd, so they run at the display refresh rate */
+void EVE_Cmd_frameWait(EVE_HalContext *phost);
+
+/** Force the current frame to be presented, for frames that write to RAM_G */
+static inline void EVE_Cmd_framePresent(EVE_HalContext *phost)
+{
+	phost->CmdFramePresent = true;
+}
+#else
+#define EVE_Cmd_frameBegin(phost) eve_noop()
+#define EVE_Cmd_frameEnd(phost) (true)
+#define EVE_Cmd_frameWait(phost) eve_noop()
+#define EVE_Cmd_framePresent(phost) eve_noop()
+#endif
+
 #endif /* #ifndef EVE_HAL_INCL__H */
 
 /* end of file */
\ No newline at end of file
@@ -35,6 +35,7 @@
 ***********************************************************************
 **********************************************************************/
 
+#if !EVE_CMD_INLINE
 void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd)
 {
 #if EVE_CMD_HOOKS
@@ -375,6 +376,7 @@ void EVE_CoCmd_dwwwwwwz_s(EVE_HalContext *phost, uint32_t cmd,
 	EVE_Cmd_wrString(phost, s, len);
 	EVE_Cmd_endFunc(phost);
 }
+#endif
 
 /**********************************************************************
 ***********************************************************************
@@ -34,6 +34,8 @@
 
 #include "EVE_HalDefs.h"
 #include "EVE_GpuDefs.h"
+#include "EVE_Cmd.h"
+#include "EVE_HalTrace.h"
 
 /*
 Commands are organized as follows:
@@ -51,11 +53,359 @@ Commands are organized as follows:
 ***********************************************************************
 **********************************************************************/
 
-/** @name Reusable templates for basic commands to save on compiled code space
+/** @name Reusable templates for basic commands
  * d: uint32_t, w: uint16_t
  * z: nul-terminated string, z_s: nul-terminated string with known length
+ * \n With EVE_CMD_INLINE, the templates are inlined into each command, and the
+ * parameters are packed into a small buffer on the stack which is written
+ * with a single EVE_Cmd_wrMem call. Otherwise they are called out-of-line,
+ * writing each parameter separately, to save on compiled code space.
+ * Each word is stored into the buffer in little endian byte order, like EVE,
+ * whatever the byte order of the host is.
  */
 ///@{
+#if EVE_CMD_INLINE
+/** Word whose bytes in memory are the little endian bytes of value, folds to value on little endian hosts */
+static inline uint32_t EVE_CoCmd_le32(uint32_t value)
+{
+	uint32_t res;
+	uint8_t *bytes = (uint8_t *)&res;
+
+	bytes[0] = value & 0xFF;
+	bytes[1] = (value >> 8) & 0xFF;
+	bytes[2] = (value >> 16) & 0xFF;
+	bytes[3] = value >> 24;
+	return res;
+}
+
+static inline void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd)
+{
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	EVE_Cmd_wr32(phost, cmd);
+}
+
+static inline void EVE_CoCmd_dd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0)
+{
+	uint32_t buffer[2];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_ddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1)
+{
+	uint32_t buffer[3];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(d1);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1, uint32_t d2)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(d1);
+	buffer[3] = EVE_CoCmd_le32(d2);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_ddddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1, uint32_t d2, uint32_t d3)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(d1);
+	buffer[3] = EVE_CoCmd_le32(d2);
+	buffer[4] = EVE_CoCmd_le32(d3);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_ddww(EVE_HalContext *phost, uint32_t cmd,
+    uint32_t d0, uint16_t w1, uint16_t w2)
+{
+	uint32_t buffer[3];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(w1 | ((uint32_t)w2 << 16));
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_ddwww(EVE_HalContext *phost, uint32_t cmd,
+    uint32_t d0, uint16_t w1, uint16_t w2, uint16_t w3)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(w1 | ((uint32_t)w2 << 16));
+	buffer[3] = EVE_CoCmd_le32(w3);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dddwwww(EVE_HalContext *phost, uint32_t cmd,
+    uint32_t d0, uint32_t d1,
+    uint16_t w2, uint16_t w3, uint16_t w4, uint16_t w5)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, d0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(d0);
+	buffer[2] = EVE_CoCmd_le32(d1);
+	buffer[3] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[4] = EVE_CoCmd_le32(w4 | ((uint32_t)w5 << 16));
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwdd(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint32_t d2, uint32_t d3)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(d2);
+	buffer[3] = EVE_CoCmd_le32(d3);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwdwwd(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint32_t d2,
+    uint16_t w3, uint16_t w4, uint32_t d5)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(d2);
+	buffer[3] = EVE_CoCmd_le32(w3 | ((uint32_t)w4 << 16));
+	buffer[4] = EVE_CoCmd_le32(d5);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwdw(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint32_t d4, uint16_t w5)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(d4);
+	buffer[4] = EVE_CoCmd_le32(w5);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwdww(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint32_t d4, uint16_t w5, uint16_t w6)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(d4);
+	buffer[4] = EVE_CoCmd_le32(w5 | ((uint32_t)w6 << 16));
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwww(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3)
+{
+	uint32_t buffer[3];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwww(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3, uint16_t w4)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(w4);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwd(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3, uint32_t d4)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(d4);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwwww(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint16_t w4, uint16_t w5, uint16_t w6)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(w4 | ((uint32_t)w5 << 16));
+	buffer[4] = EVE_CoCmd_le32(w6);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwwwww(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint16_t w4, uint16_t w5, uint16_t w6, uint16_t w7)
+{
+	uint32_t buffer[5];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(w4 | ((uint32_t)w5 << 16));
+	buffer[4] = EVE_CoCmd_le32(w6 | ((uint32_t)w7 << 16));
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+}
+
+static inline void EVE_CoCmd_dwwwwwwz(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint16_t w4, uint16_t w5, const char *s)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(w4 | ((uint32_t)w5 << 16));
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+	EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
+	EVE_Cmd_endFunc(phost);
+}
+
+static inline void EVE_CoCmd_dwwwwwwz_s(EVE_HalContext *phost, uint32_t cmd,
+    uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
+    uint16_t w4, uint16_t w5, const char *s, uint32_t len)
+{
+	uint32_t buffer[4];
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, cmd, 0))
+		return;
+#endif
+
+	buffer[0] = EVE_CoCmd_le32(cmd);
+	buffer[1] = EVE_CoCmd_le32(w0 | ((uint32_t)w1 << 16));
+	buffer[2] = EVE_CoCmd_le32(w2 | ((uint32_t)w3 << 16));
+	buffer[3] = EVE_CoCmd_le32(w4 | ((uint32_t)w5 << 16));
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wrMem(phost, (uint8_t *)buffer, sizeof(buffer));
+	EVE_Cmd_wrString(phost, s, len);
+	EVE_Cmd_endFunc(phost);
+}
+#else
 void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd);
 void EVE_CoCmd_dd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0);
 void EVE_CoCmd_ddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1);
@@ -97,6 +447,7 @@ void EVE_CoCmd_dwwwwwwz(EVE_HalContext *phost, uint32_t cmd,
 void EVE_CoCmd_dwwwwwwz_s(EVE_HalContext *phost, uint32_t cmd,
     uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
     uint16_t w4, uint16_t w5, const char *s, uint32_t len);
+#endif
 ///@}
 
 /** @brief Write a display list instruction.
@@ -149,7 +500,16 @@ static inline void EVE_CoCmd_dlStart(EVE_HalContext *phost)
  */
 static inline void EVE_CoCmd_swap(EVE_HalContext *phost)
 {
+#if EVE_CMD_FRAME_SKIP
+	/* A frame swapped without EVE_Cmd_frameEnd replaces the last presented frame */
+	if (!phost->CmdFrameChecked)
+		phost->CmdFramePresent = true;
+	phost->CmdFrameChecked = false;
+#endif
 	EVE_CoCmd_d(phost, CMD_SWAP);
+#if EVE_HAL_TRACE
+	EVE_HalTrace_frame(phost);
+#endif
 }
 
 /**
@@ -96,6 +96,117 @@ void EVE_CoDlImpl_resetCoState(EVE_HalContext *phost)
 #endif
 }
 
+#if EVE_DL_FILTER
+
+bool EVE_CoDlImpl_filter(EVE_HalContext *phost, uint32_t value)
+{
+	if ((value & 0xFFFFFF00UL) == 0xFFFFFF00UL)
+	{
+		/* Coprocessor command */
+		if (value == CMD_DLSTART)
+			EVE_CoDlImpl_resetDlState(phost);
+		else
+			phost->DlPrimitive = 0; /* May draw, active primitive unknown */
+		return false;
+	}
+
+	switch (value & 0xFF000000UL)
+	{
+	case COLOR_RGB(0, 0, 0):
+		if ((value & 0xFFFFFF) == EVE_DL_STATE.ColorRGB)
+			break;
+		EVE_DL_STATE.ColorRGB = value & 0xFFFFFF;
+		return false;
+	case COLOR_A(0):
+		if ((uint8_t)value == EVE_DL_STATE.ColorA)
+			break;
+		EVE_DL_STATE.ColorA = (uint8_t)value;
+		return false;
+	case BITMAP_HANDLE(0):
+		if ((value & 31) == EVE_DL_STATE.Handle)
+			break;
+		EVE_DL_STATE.Handle = value & 31;
+		return false;
+	case CELL(0):
+		if ((value & 127) == EVE_DL_STATE.Cell)
+			break;
+		EVE_DL_STATE.Cell = value & 127;
+		return false;
+	case LINE_WIDTH(0):
+		if ((int16_t)(value & 4095) == EVE_DL_STATE.LineWidth)
+			break;
+		EVE_DL_STATE.LineWidth = (int16_t)(value & 4095);
+		return false;
+	case POINT_SIZE(0):
+		if ((int16_t)(value & 8191) == EVE_DL_STATE.PointSize)
+			break;
+		EVE_DL_STATE.PointSize = (int16_t)(value & 8191);
+		return false;
+#if (EVE_SUPPORT_CHIPID >= EVE_FT810)
+	case VERTEX_FORMAT(0):
+		if (EVE_CHIPID < EVE_FT810)
+			return false;
+		if ((value & 7) == EVE_DL_STATE.VertexFormat)
+			break;
+		EVE_DL_STATE.VertexFormat = value & 7;
+		return false;
+#endif
+#if EVE_DL_CACHE_SCISSOR
+	case SCISSOR_XY(0, 0):
+		if (value == SCISSOR_XY(EVE_DL_STATE.ScissorX, EVE_DL_STATE.ScissorY))
+			break;
+		EVE_DL_STATE.ScissorX = (value >> SCISSOR_XY_SHIFT) & SCISSOR_XY_MASK;
+		EVE_DL_STATE.ScissorY = value & SCISSOR_XY_MASK;
+		return false;
+	case SCISSOR_SIZE(0, 0):
+		if (value == SCISSOR_SIZE(EVE_DL_STATE.ScissorWidth, EVE_DL_STATE.ScissorHeight))
+			break;
+		EVE_DL_STATE.ScissorWidth = (value >> SCISSOR_SIZE_SHIFT) & SCISSOR_SIZE_MASK;
+		EVE_DL_STATE.ScissorHeight = value & SCISSOR_SIZE_MASK;
+		return false;
+#endif
+	case BEGIN(0):
+		switch (phost->DlPrimitive)
+		{
+		case LINE_STRIP:
+		case EDGE_STRIP_R:
+		case EDGE_STRIP_L:
+		case EDGE_STRIP_A:
+		case EDGE_STRIP_B:
+			/* Repeating BEGIN starts a new strip */
+			phost->DlPrimitive = value & 15;
+			return false;
+		default:
+			break;
+		}
+		if ((value & 15) == phost->DlPrimitive)
+			break;
+		phost->DlPrimitive = value & 15;
+		return false;
+	case END():
+		phost->DlPrimitive = 0;
+		return false;
+	case SAVE_CONTEXT():
+	{
+		uint8_t nextState = (phost->DlStateIndex + 1) & EVE_DL_STATE_STACK_MASK;
+		phost->DlState[nextState] = phost->DlState[phost->DlStateIndex];
+		phost->DlStateIndex = nextState;
+		return false;
+	}
+	case RESTORE_CONTEXT():
+		phost->DlStateIndex = (phost->DlStateIndex - 1) & EVE_DL_STATE_STACK_MASK;
+		return false;
+	default:
+		return false;
+	}
+
+	/* Display list state unchanged, drop the word */
+	++phost->Stats.DlWordsFiltered;
+	return true;
+}
+
+#endif
+
 #if (EVE_SUPPORT_CHIPID < EVE_FT810)
 
 void EVE_CoDlImpl_vertex2ii_translate(EVE_HalContext *phost, uint16_t x, uint16_t y, uint8_t handle, uint8_t cell)
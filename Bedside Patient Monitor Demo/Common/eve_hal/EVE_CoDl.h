@@ -61,6 +61,17 @@ void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost);
  */
 void EVE_CoDlImpl_resetCoState(EVE_HalContext *phost);
 
+#if EVE_DL_FILTER
+/**
+ * @brief Track the display list state changed by a word written through EVE_Cmd_wr32
+ *
+ * @param phost Pointer to Hal context
+ * @param value Display list word or coprocessor command
+ * @return true If the word does not change the display list state and can be dropped
+ */
+bool EVE_CoDlImpl_filter(EVE_HalContext *phost, uint32_t value);
+#endif
+
 /**
  * @param phost Pointer to Hal context
  */
@@ -754,11 +765,11 @@ inline static void EVE_CoDl_end(EVE_HalContext *phost)
  */
 inline static void EVE_CoDl_saveContext(EVE_HalContext *phost)
 {
-#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+#if ((EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)) && !(EVE_DL_FILTER)
 	uint8_t nextState;
 #endif
 	EVE_CoCmd_dl(phost, SAVE_CONTEXT());
-#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+#if ((EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)) && !(EVE_DL_FILTER)
 	nextState = (phost->DlStateIndex + 1) & EVE_DL_STATE_STACK_MASK;
 	phost->DlState[nextState] = phost->DlState[phost->DlStateIndex];
 	phost->DlStateIndex = nextState;
@@ -773,7 +784,7 @@ inline static void EVE_CoDl_saveContext(EVE_HalContext *phost)
 inline static void EVE_CoDl_restoreContext(EVE_HalContext *phost)
 {
 	EVE_CoCmd_dl(phost, RESTORE_CONTEXT());
-#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+#if ((EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)) && !(EVE_DL_FILTER)
 	phost->DlStateIndex = (phost->DlStateIndex - 1) & EVE_DL_STATE_STACK_MASK;
 #endif
 }
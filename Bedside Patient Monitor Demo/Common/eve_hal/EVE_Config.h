@@ -119,6 +119,7 @@ Platform target:
 - FT4222_PLATFORM (set EVE_PLATFORM_FT4222)
 - MPSSE_PLATFORM (set EVE_PLATFORM_MPSSE)
 - RP2040_PLATFORM (set EVE_PLATFORM_RP2040)
+- NULLDEV_PLATFORM (set EVE_PLATFORM_NULLDEV, headless software device for host performance testing)
 
 Display resolution:
 - DISPLAY_RESOLUTION_QVGA
@@ -198,6 +199,9 @@ Remap manual use of internal macros, internal macros are mapped at the end of th
 #elif defined(FT4222_PLATFORM)
 #undef FT4222_PLATFORM
 #define EVE_PLATFORM_FT4222
+#elif defined(NULLDEV_PLATFORM)
+#undef NULLDEV_PLATFORM
+#define EVE_PLATFORM_NULLDEV
 #endif
 
 /*
@@ -248,7 +252,8 @@ Validate the configured options.
     || defined(MM900EV_LITE) || defined(MM930MINI)                 \
     || defined(MM930LITE) || defined(MM932LC)                      \
     || defined(EVE_PLATFORM_FT4222) || defined(EVE_PLATFORM_MPSSE) \
-    || defined(EVE_PLATFORM_RP2040) || defined(EVE_PLATFORM_MM2040EV)
+    || defined(EVE_PLATFORM_RP2040) || defined(EVE_PLATFORM_MM2040EV) \
+    || defined(EVE_PLATFORM_NULLDEV)
 #define EVE_PLATFORM_AVAILABLE
 #endif
 
@@ -1212,6 +1217,7 @@ Ultimately, the platform selection must set one of the following internal platfo
 - FT4222_PLATFORM
 - MPSSE_PLATFORM
 - RP2040_PLATFORM
+- NULLDEV_PLATFORM
 These may only be set by one of the platform target definitions, and should not be set manually by the user.
 
 */
@@ -1239,6 +1245,10 @@ These may only be set by one of the platform target definitions, and should not
 #elif defined(EVE_PLATFORM_RP2040) || defined(EVE_PLATFORM_MM2040EV)
 #define RP2040_PLATFORM
 
+#elif defined(EVE_PLATFORM_NULLDEV)
+#define NULLDEV_PLATFORM
+#define EVE_HOST EVE_HOST_NULLDEV
+
 #endif
 
 #if defined(FT4222_PLATFORM)
@@ -1269,7 +1279,8 @@ These may only be set by one of the platform target definitions, and should not
     || defined(FT4222_PLATFORM)   \
     || defined(MPSSE_PLATFORM)    \
     || defined(BT8XXEMU_PLATFORM) \
-    || defined(RP2040_PLATFORM)
+    || defined(RP2040_PLATFORM)   \
+    || defined(NULLDEV_PLATFORM)
 #define EVE_PLATFORM_AVAILABLE
 #endif
 
@@ -1305,9 +1316,69 @@ These may only be set by one of the platform target definitions, and should not
 #define EVE_DL_END_PRIMITIVE 0 /**< Whether the END command is sent */
 #define EVE_DL_STATE_STACK_SIZE 4
 #define EVE_DL_STATE_STACK_MASK 3
+#ifndef EVE_DL_FILTER
+#define EVE_DL_FILTER 0 /**< Drop display list words written through EVE_Cmd_wr32 that do not change the cached display list state. Requires EVE_DL_OPTIMIZE. Parameters of coprocessor commands must then be written between EVE_Cmd_startFunc and EVE_Cmd_endFunc, or with EVE_Cmd_wrMem. Display list words written with EVE_Cmd_wrMem are not filtered nor tracked */
+#endif
+#if !(EVE_DL_OPTIMIZE)
+#undef EVE_DL_FILTER
+#define EVE_DL_FILTER 0
+#endif
 
 #define EVE_CMD_HOOKS 0 /**< Allow adding a callback hook into EVE_CoCmd calls using CoCmdHook in EVE_HalContext */
 
+#ifndef EVE_CMD_INLINE
+#define EVE_CMD_INLINE 1 /**< Inline the basic coprocessor command templates, packing each command on the stack and writing it with a single EVE_Cmd_wrMem call. Set to 0 to save on compiled code space */
+#endif
+
+#ifndef EVE_HAL_TRACE
+#define EVE_HAL_TRACE 0 /**< Allow recording all transfers to a trace file, see EVE_HalTrace.h. Requires a platform with stdio */
+#endif
+#define EVE_HAL_TRACE_BUFFER 256 /**< Size of the buffer that collects the payload of a transfer before it is written to the trace file */
+
+#define EVE_CMD_DEFER 1 /**< Allow staging coprocessor commands in host memory and committing them in bursts, see EVE_Cmd_setDefer */
+#define EVE_CMD_DEFER_SIZE 4096 /**< Size of the host-side command staging buffer in bytes, multiple of 4 */
+
+#ifndef EVE_CMD_SPACE_LOW_WATER
+#define EVE_CMD_SPACE_LOW_WATER (EVE_CMD_FIFO_SIZE >> 2) /**< Default low-water mark of the tracked coprocessor FIFO space, see EVE_Cmd_setSpaceLowWater. Between commands, the space is read again without waiting once the tracked value drops below it. 0 to only read it when a write does not fit */
+#endif
+
+#define EVE_CMD_FRAMES_IN_FLIGHT 2 /**< Maximum number of frames submitted by EVE_Cmd_submitFrame that may be pending on the coprocessor, 0 to disable */
+#define EVE_CMD_FENCE_ADDR (RAM_G + RAM_G_SIZE - 4) /**< Address in RAM_G where the coprocessor writes the sequence number of each completed frame */
+
+#define EVE_CMD_FRAME_SKIP 1 /**< Allow skipping frames that are identical to the last presented frame, see EVE_Cmd_setFrameSkip */
+#define EVE_CMD_FRAME_WAIT_MAX 100 /**< Longest wait in milliseconds for REG_FRAMES to advance in EVE_Cmd_frameWait */
+
+#define EVE_SEG_COUNT 4 /**< Number of retained display list segments available through EVE_Seg_begin, 0 to disable */
+#define EVE_SEG_SIZE 4096 /**< Size of the RAM_G area reserved for each retained segment in bytes, multiple of 4 */
+#define EVE_SEG_ADDR ((EVE_CMD_FENCE_ADDR & ~0x3FUL) - (EVE_SEG_COUNT * EVE_SEG_SIZE)) /**< Start of the RAM_G area reserved for retained segments, right below the frame fence */
+
+#define EVE_RAMG_BLOCKS 32 /**< Maximum number of allocated and free blocks tracked by EVE_RamG_alloc, 0 to disable */
+#if EVE_SEG_COUNT
+#define EVE_RAMG_END EVE_SEG_ADDR /**< End of the RAM_G heap managed by EVE_RamG_alloc, below the areas reserved by the HAL */
+#elif EVE_CMD_FRAMES_IN_FLIGHT
+#define EVE_RAMG_END (EVE_CMD_FENCE_ADDR & ~0x3FUL)
+#else
+#define EVE_RAMG_END (RAM_G + RAM_G_SIZE)
+#endif
+
+#define EVE_MEDIA_STREAM_BUFFERS 2 /**< Number of host buffers used by EVE_MediaFifo_stream, at least 2 so reading the source overlaps writing the media FIFO */
+#if defined(FT9XX_PLATFORM) || defined(RP2040_PLATFORM)
+#define EVE_MEDIA_STREAM_BUFFER_SIZE 512 /**< Size of each host buffer used by EVE_MediaFifo_stream in bytes, multiple of 4. The buffers are on the stack */
+#else
+#define EVE_MEDIA_STREAM_BUFFER_SIZE 8192
+#endif
+#ifndef EVE_MEDIA_STREAM_THREAD
+#define EVE_MEDIA_STREAM_THREAD 0 /**< Set to 1 to read the source ahead on a pthread in EVE_MediaFifo_stream, on hosts with pthreads. The EVE_MEDIA_STREAM_THREAD CMake option sets it on UNIX hosts. Otherwise reads only overlap for sources implementing StartRead */
+#endif
+
+#ifndef EVE_LOADFILE_MMAP
+#if defined(__linux__)
+#define EVE_LOADFILE_MMAP 1 /**< Map files into memory in the stdio raw, inflate and image loaders, and write them to EVE straight from the mapping */
+#else
+#define EVE_LOADFILE_MMAP 0
+#endif
+#endif
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
@@ -1423,7 +1494,8 @@ typedef char eve_tchar_t;
     + (defined(FT4222_PLATFORM) ? 1 : 0)   \
     + (defined(MPSSE_PLATFORM) ? 1 : 0)    \
     + (defined(BT8XXEMU_PLATFORM) ? 1 : 0) \
-    + (defined(RP2040_PLATFORM) ? 1 : 0))  \
+    + (defined(RP2040_PLATFORM) ? 1 : 0)   \
+    + (defined(NULLDEV_PLATFORM) ? 1 : 0)) \
     > 1
 #pragma message(__FILE__ "(" EVE_CONFIG_STR(__LINE__) "): warning PLATFORM: " \
                                                       "More than one platform has been selected")
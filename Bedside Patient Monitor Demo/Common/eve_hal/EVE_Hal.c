@@ -105,6 +105,8 @@ bool EVE_Hal_open(EVE_HalContext *phost, const EVE_HalParameters *parameters)
 	memset(phost, 0, sizeof(EVE_HalContext));
 	phost->UserContext = parameters->UserContext;
 	phost->CbCmdWait = parameters->CbCmdWait;
+	phost->CmdSpaceLowWater = EVE_CMD_SPACE_LOW_WATER;
+	phost->StatsStart = EVE_millis();
 	return EVE_HalImpl_open(phost, parameters);
 }
 
@@ -123,6 +125,9 @@ void EVE_Hal_close(EVE_HalContext *phost)
 
 #ifdef EVE_SUPPORT_MEDIAFIFO
 	EVE_Util_closeFile(phost);
+#endif
+#if EVE_HAL_TRACE
+	EVE_HalTrace_stop(phost);
 #endif
 	EVE_HalImpl_close(phost);
 	memset(phost, 0, sizeof(EVE_HalContext));
@@ -210,6 +215,75 @@ void EVE_Hal_rdMem(EVE_HalContext *phost, uint8_t *result, uint32_t addr, uint32
 	EVE_Hal_endTransfer(phost);
 }
 
+/** Maximum number of registers that EVE_Hal_rdRegs sorts at once */
+#define EVE_HAL_RDREGS_MAX 16
+/** Largest gap in bytes between registers that is read through rather than starting a new read */
+#define EVE_HAL_RDREGS_GAP 16
+/** Largest span in bytes covered by a single burst read */
+#define EVE_HAL_RDREGS_SPAN 64
+
+/**
+ * @brief Read a list of 32-bit registers in as few burst reads as possible
+ *
+ * @param phost Pointer to Hal context
+ * @param addrs Addresses of the registers
+ * @param values Receives the register values
+ * @param n Number of registers
+ */
+void EVE_Hal_rdRegs(EVE_HalContext *phost, const uint32_t *addrs, uint32_t *values, size_t n)
+{
+	uint8_t order[EVE_HAL_RDREGS_MAX];
+	uint8_t span[EVE_HAL_RDREGS_SPAN];
+	size_t i, j;
+
+	if (n > EVE_HAL_RDREGS_MAX)
+	{
+		/* Process in batches */
+		EVE_Hal_rdRegs(phost, addrs, values, EVE_HAL_RDREGS_MAX);
+		EVE_Hal_rdRegs(phost, &addrs[EVE_HAL_RDREGS_MAX], &values[EVE_HAL_RDREGS_MAX], n - EVE_HAL_RDREGS_MAX);
+		return;
+	}
+
+	/* Sort by address */
+	for (i = 0; i < n; ++i)
+	{
+		uint8_t idx = (uint8_t)i;
+		eve_assert(!(addrs[idx] & 0x3));
+		for (j = i; j > 0 && addrs[order[j - 1]] > addrs[idx]; --j)
+			order[j] = order[j - 1];
+		order[j] = idx;
+	}
+
+	for (i = 0; i < n;)
+	{
+		uint32_t start = addrs[order[i]];
+		uint32_t end = start + 4;
+		size_t first = i;
+
+		/* Extend the span over the following registers which are close enough */
+		for (++i; i < n; ++i)
+		{
+			uint32_t addr = addrs[order[i]];
+			if (addr > end + EVE_HAL_RDREGS_GAP || addr + 4 - start > EVE_HAL_RDREGS_SPAN)
+				break;
+			if (addr + 4 > end)
+				end = addr + 4;
+		}
+
+		EVE_Hal_rdMem(phost, span, start, end - start);
+
+		/* Scatter the results */
+		for (j = first; j < i; ++j)
+		{
+			const uint8_t *b = &span[addrs[order[j]] - start];
+			values[order[j]] = (uint32_t)b[0]
+			    | ((uint32_t)b[1] << 8)
+			    | ((uint32_t)b[2] << 16)
+			    | ((uint32_t)b[3] << 24);
+		}
+	}
+}
+
 /**
  * @brief Write 8 bits to Coprocessor's memory
  *
@@ -282,6 +356,108 @@ void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const u
 	EVE_Hal_endTransfer(phost);
 }
 
+/** Maximum number of vectors that EVE_Hal_wrv sorts by address */
+#define EVE_HAL_WRV_SORT_MAX 32
+
+/**
+ * @brief Sort vectors by destination address, if it is safe to reorder them
+ *
+ * @param v Vectors to write
+ * @param n Number of vectors
+ * @param order Receives the write order
+ * @return true True if the vectors can be written in the sorted order
+ * @return false False if they must be written in the specified order
+ */
+static bool wrvSort(const EVE_IoVec *v, size_t n, uint8_t *order)
+{
+	size_t i, j;
+
+	if (n > EVE_HAL_WRV_SORT_MAX)
+		return false;
+
+	/* Only RAM_G writes are free of side effects */
+	for (i = 0; i < n; ++i)
+	{
+		uint32_t offset = v[i].Addr - RAM_G;
+		if (offset >= (uint32_t)RAM_G_SIZE || v[i].Size > (uint32_t)RAM_G_SIZE - offset)
+			return false;
+	}
+
+	/* Stable insertion sort, the number of vectors is small */
+	for (i = 0; i < n; ++i)
+	{
+		uint8_t idx = (uint8_t)i;
+		for (j = i; j > 0 && v[order[j - 1]].Addr > v[idx].Addr; --j)
+			order[j] = order[j - 1];
+		order[j] = idx;
+	}
+
+	/* Overlapping writes must keep their order */
+	for (i = 1; i < n; ++i)
+	{
+		const EVE_IoVec *prev = &v[order[i - 1]];
+		if (prev->Addr + prev->Size > v[order[i]].Addr)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Write vectors through the transfer functions, one transfer per contiguous run.
+ * Fallback for backends without a native vectored write
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrvTransfer(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			size_t i;
+			EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, v[0].Addr);
+			for (i = 0; i < run; ++i)
+				EVE_Hal_transferMem(phost, NULL, v[i].Buffer, v[i].Size);
+			EVE_Hal_endTransfer(phost);
+		}
+		v += run;
+		n -= run;
+	}
+}
+
+/**
+ * @brief Write a list of buffers to Coprocessor's memory, joining contiguous destinations
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write
+ * @param n Number of vectors
+ */
+void EVE_Hal_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	EVE_IoVec sorted[EVE_HAL_WRV_SORT_MAX];
+	uint8_t order[EVE_HAL_WRV_SORT_MAX];
+	size_t i;
+
+	if (wrvSort(v, n, order))
+	{
+		for (i = 0; i < n; ++i)
+			sorted[i] = v[order[i]];
+		v = sorted;
+	}
+
+#if EVE_HAL_TRACE
+	/* Go through the traced transfer functions, so the trace can be replayed */
+	EVE_HalImpl_wrvTransfer(phost, v, n);
+#else
+	EVE_HalImpl_wrv(phost, v, n);
+#endif
+}
+
 /**
  * @brief Write a string to Coprocessor's memory
  *
@@ -476,6 +652,29 @@ void EVE_Host_resetRemoval(EVE_HalContext *phost)
 }
 #endif
 
+/**
+ * @brief Copy the performance counters accumulated since the last reset
+ *
+ * @param phost Pointer to Hal context
+ * @param stats Receives the counters
+ */
+void EVE_Hal_statsSnapshot(EVE_HalContext *phost, EVE_HalStats *stats)
+{
+	*stats = phost->Stats;
+	stats->Millis = EVE_millis() - phost->StatsStart;
+}
+
+/**
+ * @brief Reset the performance counters
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_statsReset(EVE_HalContext *phost)
+{
+	memset(&phost->Stats, 0, sizeof(EVE_HalStats));
+	phost->StatsStart = EVE_millis();
+}
+
 /**
  * @brief Display a fullscreen debug message using TEXT8X8. Uses the back of RAM_G.
  *
@@ -101,6 +101,14 @@ typedef int (*EVE_CoCmdHook)(EVE_HalContext *phost, uint32_t cmd, uint32_t state
 /** Hook into coprocessor reset */
 typedef void (*EVE_ResetCallback)(EVE_HalContext *phost, bool fault);
 
+/** One destination region of a vectored write, see EVE_Hal_wrv */
+typedef struct EVE_IoVec
+{
+	uint32_t Addr; /**< Destination address */
+	const uint8_t *Buffer; /**< Data to write */
+	uint32_t Size; /**< Size of the data in bytes */
+} EVE_IoVec;
+
 typedef enum EVE_HOST_T
 {
 	EVE_HOST_UNKNOWN = 0, /**< 0 */
@@ -108,6 +116,7 @@ typedef enum EVE_HOST_T
 	EVE_HOST_FT4222,
 	EVE_HOST_MPSSE,
 	EVE_HOST_EMBEDDED,
+	EVE_HOST_NULLDEV,
 
 	EVE_HOST_NB
 } EVE_HOST_T;
@@ -198,6 +207,53 @@ typedef struct EVE_HalDlState
 } EVE_HalDlState;
 #endif
 
+/** HAL performance counters, accumulated since the last EVE_Hal_statsReset.
+Wait times are summed from millisecond timestamps taken around each wait,
+so over many frames they average out to the actual time spent waiting */
+typedef struct EVE_HalStats
+{
+	uint32_t Millis; /**< Time since the counters were reset, filled in by EVE_Hal_statsSnapshot */
+	uint32_t Transfers; /**< Number of transfers started through EVE_Hal_startTransfer */
+	uint32_t BytesWritten; /**< Payload bytes written to the device, excluding address bytes */
+	uint32_t BytesRead; /**< Payload bytes read from the device, excluding address and dummy bytes */
+	uint32_t CmdSpaceReads; /**< Number of times the free space of the coprocessor FIFO was read from the device */
+	uint32_t CmdBytes; /**< Number of bytes written into the coprocessor FIFO, divide by 4 for command words */
+	uint32_t CmdFaults; /**< Number of coprocessor faults detected */
+	uint32_t DlWordsFiltered; /**< Number of display list words dropped by EVE_DL_FILTER */
+	uint32_t FramesSkipped; /**< Number of frames not presented because they were identical to the last presented frame */
+	uint32_t WaitFlushMillis; /**< Time blocked in EVE_Cmd_waitFlush and EVE_Cmd_waitFrame */
+	uint32_t WaitSpaceMillis; /**< Time blocked in EVE_Cmd_waitSpace */
+	uint32_t WaitMediaFifoMillis; /**< Time blocked in EVE_MediaFifo_waitSpace */
+} EVE_HalStats;
+
+#if EVE_SEG_COUNT
+/** Retained display list segment, see EVE_Seg.h */
+typedef struct EVE_HalSeg
+{
+	uint32_t Size; /**< Size of the recorded segment in RAM_G, 0 when not recorded */
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+	EVE_HalDlState DlState; /**< Display list state left behind by the segment */
+#endif
+#if (EVE_DL_OPTIMIZE)
+	uint32_t CoFgColor;
+	uint32_t CoBgColor;
+	uint8_t DlPrimitive;
+	bool CoBitmapTransform;
+#endif
+	bool List; /**< Replayed with CMD_CALLLIST, otherwise with CMD_APPEND */
+} EVE_HalSeg;
+#endif
+
+#if EVE_RAMG_BLOCKS
+/** Block of the RAM_G heap, see EVE_RamG.h */
+typedef struct EVE_HalRamGBlock
+{
+	uint32_t Addr;
+	uint32_t Size;
+	bool Used;
+} EVE_HalRamGBlock;
+#endif
+
 typedef struct EVE_HalContext
 {
 	/** Pointer to user context */
@@ -240,6 +296,9 @@ typedef struct EVE_HalContext
 #if defined(RP2040_PLATFORM)
 	void *SpiPort; /* SPI port */
 #endif
+#if defined(NULLDEV_PLATFORM) || defined(EVE_MULTI_PLATFORM_TARGET)
+	void *NullDev; /**< Software device state of the NULLDEV backend */
+#endif
 
 #if defined(FT4222_PLATFORM) | defined(MPSSE_PLATFORM)
 	/** Currently configured SPI clock rate. In kHz.
@@ -286,11 +345,46 @@ typedef struct EVE_HalContext
 	uint8_t CmdBufferIndex;
 
 	uint16_t CmdSpace; /**< Free space, cached value */
+	uint16_t CmdSpaceLowWater; /**< Read the free space again between commands once CmdSpace drops below this, see EVE_Cmd_setSpaceLowWater */
 #if !defined(EVE_SUPPORT_CMDB)
 	uint16_t CmdWp; /**< Write pointer, only valid when CMDB is not used */
 #endif
 	///@}
 
+	/** @name Host-side command staging buffer, committed in bursts when deferred mode is enabled */
+	///@{
+#if EVE_CMD_DEFER
+	uint8_t CmdDeferBuffer[EVE_CMD_DEFER_SIZE];
+	uint32_t CmdDeferIndex;
+	uint32_t CmdFuncDeferIndex; /**< Staged bytes when the function being written began, only commands before it are complete */
+#endif
+	///@}
+
+	/** @name Frame fence, for frames submitted without waiting for the coprocessor */
+	///@{
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	uint32_t CmdFrameSubmitted; /**< Sequence number of the last submitted frame */
+	uint32_t CmdFrameDone; /**< Sequence number of the last frame known to be completed */
+#endif
+	///@}
+
+	/** @name Frame skipping, for frames identical to the last presented frame */
+	///@{
+#if EVE_CMD_FRAME_SKIP
+	uint32_t CmdFrameHash; /**< Hash of the commands written since EVE_Cmd_frameBegin */
+	uint32_t CmdFramePresentedHash; /**< Hash of the last presented frame */
+	uint32_t CmdFramePresentedMillis; /**< Time when the last frame was presented */
+	uint32_t CmdFrameRefreshMillis; /**< Present identical frames after this time, 0 to never present them */
+#if EVE_CMD_DEFER
+	uint32_t CmdFrameDeferIndex; /**< Staged bytes when the frame began */
+	bool CmdFrameCommitted; /**< Part of the frame was committed, it can no longer be dropped */
+#endif
+	bool CmdFrameSkip; /**< Skipping identical frames is enabled */
+	bool CmdFramePresent; /**< The current frame must be presented */
+	bool CmdFrameChecked; /**< The next CMD_SWAP presents the frame checked by EVE_Cmd_frameEnd */
+#endif
+	///@}
+
 	/** @name Media FIFO state */
 	///@{
 #if defined(EVE_SUPPORT_MEDIAFIFO)
@@ -332,6 +426,42 @@ typedef struct EVE_HalContext
 	bool CmdFunc; /**< Flagged while transfer to cmd is kept open */
 	bool CmdFault; /**< Flagged when coprocessor is in fault mode and needs to be reset */
 	bool CmdWaiting; /**< Flagged while waiting for CMD write (to check during any function that may be called by CbCmdWait) */
+	bool CmdDefer; /**< Flagged while commands are staged in host memory instead of written directly */
+	bool CmdSpaceLow; /**< Flagged when the last free space read from the device was below CmdSpaceLowWater */
+	///@}
+
+	/** @name Statistics */
+	///@{
+	EVE_HalStats Stats; /**< Performance counters, use EVE_Hal_statsSnapshot to read */
+	uint32_t StatsStart; /**< Time of the last EVE_Hal_statsReset, in milliseconds */
+	///@}
+
+	/** @name Retained display list segments */
+	///@{
+#if EVE_SEG_COUNT
+	EVE_HalSeg Seg[EVE_SEG_COUNT];
+	uint32_t SegStart; /**< REG_CMD_DL when recording started */
+	uint8_t SegRecording; /**< Id of the segment being recorded plus one, 0 when not recording */
+#endif
+	///@}
+
+	/** @name RAM_G allocator */
+	///@{
+#if EVE_RAMG_BLOCKS
+	EVE_HalRamGBlock RamG[EVE_RAMG_BLOCKS]; /**< Allocated and free blocks in address order, covering the heap */
+	uint8_t RamGCount; /**< Number of blocks in RamG, 0 before the first use */
+	uint32_t RamGHighWater; /**< Highest end of an allocation, relative to RAM_G */
+#endif
+	///@}
+
+	/** @name Transport trace */
+	///@{
+#if EVE_HAL_TRACE
+	void *TraceFile; /**< Trace file being recorded, NULL when not recording */
+	uint32_t TraceStart; /**< Time when recording started, in milliseconds */
+	uint8_t TraceData[EVE_HAL_TRACE_BUFFER]; /**< Payload of the current transfer, not yet written to the trace file */
+	uint16_t TraceDataIndex;
+#endif
 	///@}
 
 } EVE_HalContext;
@@ -414,12 +544,24 @@ uint16_t EVE_Hal_rd16(EVE_HalContext *phost, uint32_t addr);
 uint32_t EVE_Hal_rd32(EVE_HalContext *phost, uint32_t addr);
 void EVE_Hal_rdMem(EVE_HalContext *phost, uint8_t *result, uint32_t addr, uint32_t size);
 
+/** Read a list of 32-bit registers.
+Registers that are close together are read with a single burst read
+covering all of them. Results are stored in `values` in the order of `addrs` */
+void EVE_Hal_rdRegs(EVE_HalContext *phost, const uint32_t *addrs, uint32_t *values, size_t n);
+
 void EVE_Hal_wr8(EVE_HalContext *phost, uint32_t addr, uint8_t v);
 void EVE_Hal_wr16(EVE_HalContext *phost, uint32_t addr, uint16_t v);
 void EVE_Hal_wr32(EVE_HalContext *phost, uint32_t addr, uint32_t v);
 void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size);
 void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const uint8_t *buffer, uint32_t size);
 void EVE_Hal_wrString(EVE_HalContext *phost, uint32_t addr, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
+
+/** Write a list of buffers to scattered addresses.
+Buffers with contiguous destinations are written in a single transfer.
+When all destinations are in RAM_G and do not overlap, they are written in
+address order, to join as many of them as possible.
+Register writes are always done in the specified order */
+void EVE_Hal_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
 ///@}
 
 /*********
@@ -613,6 +755,21 @@ void EVE_Host_resetRemoval(EVE_HalContext *phost);
 #endif
 ///@}
 
+/***************
+** STATISTICS **
+***************/
+
+/** @name STATISTICS */
+///@{
+
+/** Copy the performance counters accumulated since the last reset */
+void EVE_Hal_statsSnapshot(EVE_HalContext *phost, EVE_HalStats *stats);
+
+/** Reset the performance counters.
+Call once per frame after taking a snapshot to get per-frame counters */
+void EVE_Hal_statsReset(EVE_HalContext *phost);
+///@}
+
 /**********
 ** DEBUG **
 **********/
@@ -35,6 +35,22 @@
 
 #ifndef EVE_HAL_IMPL__H
 #define EVE_HAL_IMPL__H
+#include "EVE_Config.h"
+
+#if EVE_HAL_TRACE && defined(EVE_HALIMPL_BACKEND)
+/* Backends implement the transfer functions under these names,
+the public functions in EVE_HalTrace.c record the traffic and call them */
+#define EVE_Hal_startTransfer EVE_HalImpl_startTransfer
+#define EVE_Hal_endTransfer EVE_HalImpl_endTransfer
+#define EVE_Hal_transfer8 EVE_HalImpl_transfer8
+#define EVE_Hal_transfer16 EVE_HalImpl_transfer16
+#define EVE_Hal_transfer32 EVE_HalImpl_transfer32
+#define EVE_Hal_transferMem EVE_HalImpl_transferMem
+#define EVE_Hal_transferProgMem EVE_HalImpl_transferProgMem
+#define EVE_Hal_transferString EVE_HalImpl_transferString
+#define EVE_Hal_flush EVE_HalImpl_flush
+#endif
+
 #include "EVE_HalDefs.h"
 
 extern EVE_HalPlatform g_HalPlatform;
@@ -81,6 +97,54 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value);
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value);
 
 void EVE_Hal_flush(EVE_HalContext *phost);
+
+/** Write vectors to Coprocessor's memory in the given order.
+Each contiguous run is sent as one bus transfer with a single address phase.
+Implemented natively by each backend, called by EVE_Hal_wrv */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+
+/** Generic EVE_HalImpl_wrv built on startTransfer, transferMem and endTransfer */
+void EVE_HalImpl_wrvTransfer(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+
+/** Find the contiguous run of vectors starting at v[0].
+Returns the number of vectors in the run, and its total size in bytes.
+Empty vectors never break a run */
+static inline size_t EVE_HalImpl_wrvRun(const EVE_IoVec *v, size_t n, uint32_t *size)
+{
+	uint32_t total = v[0].Size;
+	size_t i;
+
+	for (i = 1; i < n; ++i)
+	{
+		if (v[i].Size && v[i].Addr != v[0].Addr + total)
+			break;
+		total += v[i].Size;
+	}
+	*size = total;
+	return i;
+}
+
+/** Count payload bytes of the current transfer in the HAL statistics.
+Called by the backends from their public transfer functions */
+static inline void EVE_HalImpl_countBytes(EVE_HalContext *phost, uint32_t size)
+{
+	if (phost->Status == EVE_STATUS_READING)
+		phost->Stats.BytesRead += size;
+	else
+		phost->Stats.BytesWritten += size;
+}
+
+#if EVE_HAL_TRACE
+void EVE_HalImpl_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr);
+void EVE_HalImpl_endTransfer(EVE_HalContext *phost);
+uint8_t EVE_HalImpl_transfer8(EVE_HalContext *phost, uint8_t value);
+uint16_t EVE_HalImpl_transfer16(EVE_HalContext *phost, uint16_t value);
+uint32_t EVE_HalImpl_transfer32(EVE_HalContext *phost, uint32_t value);
+void EVE_HalImpl_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size);
+void EVE_HalImpl_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
+uint32_t EVE_HalImpl_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
+void EVE_HalImpl_flush(EVE_HalContext *phost);
+#endif
 ///@}
 
 /*********
@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 
+#define EVE_HALIMPL_BACKEND
 #include "EVE_HalImpl.h"
 #include "EVE_Platform.h"
 #if defined(BT8XXEMU_PLATFORM)
@@ -259,6 +260,7 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	++phost->Stats.Transfers;
 
 	if (rw == EVE_TRANSFER_READ)
 	{
@@ -324,6 +326,7 @@ static inline uint8_t transfer8(EVE_HalContext *phost, uint8_t value)
  */
 uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 {
+	EVE_HalImpl_countBytes(phost, 1);
 	return transfer8(phost, value);
 }
 
@@ -337,6 +340,7 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 {
 	uint16_t retVal = 0;
+	EVE_HalImpl_countBytes(phost, 2);
 	retVal = transfer8(phost, value & 0xFF);
 	retVal |= (uint16_t)transfer8(phost, (value >> 8) & 0xFF) << 8;
 	return retVal;
@@ -352,6 +356,7 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 {
 	uint32_t retVal = 0;
+	EVE_HalImpl_countBytes(phost, 4);
 	retVal = transfer8(phost, value & 0xFF);
 	retVal |= (uint32_t)transfer8(phost, (value >> 8) & 0xFF) << 8;
 	retVal |= (uint32_t)transfer8(phost, (value >> 16) & 0xFF) << 16;
@@ -370,6 +375,7 @@ uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size)
 {
 	uint32_t i;
+	EVE_HalImpl_countBytes(phost, size);
 	if (result && buffer)
 	{
 		for (i = 0; i < size; ++i)
@@ -398,6 +404,7 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size)
 {
 	uint32_t i;
+	EVE_HalImpl_countBytes(phost, size);
 	if (result && buffer)
 	{
 		for (i = 0; i < size; ++i)
@@ -469,6 +476,7 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 #elif 1
 	// FT4222
@@ -508,6 +516,7 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 #else
 	// FT900
@@ -531,9 +540,42 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 #endif
 }
+
+/**
+ * @brief Write vectors to Coprocessor's memory, one transfer per contiguous run
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			size_t i;
+			EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, v[0].Addr);
+			phost->Stats.BytesWritten += size;
+			for (i = 0; i < run; ++i)
+			{
+				const uint8_t *buffer = v[i].Buffer;
+				uint32_t j;
+				for (j = 0; j < v[i].Size; ++j)
+					transfer8(phost, buffer[j]);
+			}
+			EVE_Hal_endTransfer(phost);
+		}
+		v += run;
+		n -= run;
+	}
+}
 ///@}
 
 /************
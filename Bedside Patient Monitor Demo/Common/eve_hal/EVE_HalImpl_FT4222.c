@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 
+#define EVE_HALIMPL_BACKEND
 #include "EVE_HalImpl.h"
 #include "EVE_Platform.h"
 #if defined(FT4222_PLATFORM)
@@ -828,6 +829,7 @@ static inline bool wrBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	++phost->Stats.Transfers;
 
 	if (!(EVE_CHIPID >= EVE_FT810) && addr == REG_CMD_WRITE && rw == EVE_TRANSFER_WRITE)
 	{
@@ -932,6 +934,7 @@ void EVE_Hal_flush(EVE_HalContext *phost)
  */
 uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 {
+	EVE_HalImpl_countBytes(phost, 1);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -959,6 +962,7 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 {
 	uint8_t buffer[2];
+	EVE_HalImpl_countBytes(phost, 2);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	if (phost->SpiWpWriting)
@@ -994,6 +998,7 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 {
 	uint8_t buffer[4];
+	EVE_HalImpl_countBytes(phost, 4);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -1031,6 +1036,7 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -1065,6 +1071,7 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -1150,8 +1157,52 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 }
+
+/**
+ * @brief Write vectors to Coprocessor's memory, one SPI transaction per contiguous run
+ *
+ * The vectors of a run are gathered behind a single header in the write buffer.
+ * Runs larger than the write buffer are split at the FT4222 transfer size.
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	eve_assert(phost->Status == EVE_STATUS_OPENED);
+
+	/* Buffered writes go first */
+	if (!flush(phost))
+		return;
+
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			size_t i;
+
+			++phost->Stats.Transfers;
+			phost->Stats.BytesWritten += size;
+
+			phost->SpiRamGAddr = v[0].Addr;
+			for (i = 0; i < run; ++i)
+			{
+				if (v[i].Size && !wrBuffer(phost, v[i].Buffer, v[i].Size))
+					return;
+			}
+			if (!flush(phost))
+				return;
+		}
+		v += run;
+		n -= run;
+	}
+}
 ///@}
 
 /************
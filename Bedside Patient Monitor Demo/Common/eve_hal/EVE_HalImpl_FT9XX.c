@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 
+#define EVE_HALIMPL_BACKEND
 #include "EVE_HalImpl.h"
 #include "EVE_Platform.h"
 #if defined(FT9XX_PLATFORM)
@@ -253,6 +254,7 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	++phost->Stats.Transfers;
 
 	if (rw == EVE_TRANSFER_READ)
 	{
@@ -357,6 +359,7 @@ static inline uint8_t transfer8(EVE_HalContext *phost, uint8_t value)
  */
 uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 {
+	EVE_HalImpl_countBytes(phost, 1);
 	return transfer8(phost, value);
 }
 
@@ -370,6 +373,7 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 {
 	uint8_t buffer[2];
+	EVE_HalImpl_countBytes(phost, 2);
 	if (phost->Status == EVE_STATUS_READING)
 	{
 		rdBuffer(phost, buffer, 2);
@@ -395,6 +399,7 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 {
 	uint8_t buffer[4];
+	EVE_HalImpl_countBytes(phost, 4);
 	if (phost->Status == EVE_STATUS_READING)
 	{
 		rdBuffer(phost, buffer, 4);
@@ -427,6 +432,7 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 	if (result && buffer)
 	{
 		/* not implemented */
@@ -455,6 +461,7 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 	if (result && buffer)
 	{
 		/* not implemented */
@@ -520,8 +527,36 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 }
+
+/**
+ * @brief Write vectors to Coprocessor's memory, one transfer per contiguous run
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			size_t i;
+			EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, v[0].Addr);
+			phost->Stats.BytesWritten += size;
+			for (i = 0; i < run; ++i)
+				wrBuffer(phost, v[i].Buffer, v[i].Size);
+			EVE_Hal_endTransfer(phost);
+		}
+		v += run;
+		n -= run;
+	}
+}
 ///@}
 
 /************
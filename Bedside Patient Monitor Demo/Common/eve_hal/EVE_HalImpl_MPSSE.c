@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 
+#define EVE_HALIMPL_BACKEND
 #include "EVE_HalImpl.h"
 #include "EVE_Platform.h"
 #if defined(MPSSE_PLATFORM)
@@ -592,6 +593,7 @@ void EVE_Hal_flush(EVE_HalContext *phost)
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	++phost->Stats.Transfers;
 
 #if defined(EVE_BUFFER_WRITES)
 	if (!(EVE_CHIPID >= EVE_FT810) && addr == REG_CMD_WRITE && rw == EVE_TRANSFER_WRITE)
@@ -718,6 +720,7 @@ void EVE_Hal_endTransfer(EVE_HalContext *phost)
  */
 uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 {
+	EVE_HalImpl_countBytes(phost, 1);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -736,6 +739,7 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 {
 	uint8_t buffer[2];
+	EVE_HalImpl_countBytes(phost, 2);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	if (phost->SpiWpWriting)
@@ -771,6 +775,7 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 {
 	uint8_t buffer[4];
+	EVE_HalImpl_countBytes(phost, 4);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -808,6 +813,7 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -842,6 +848,7 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 	if (!size)
 		return;
 
+	EVE_HalImpl_countBytes(phost, size);
 #if defined(EVE_BUFFER_WRITES)
 #if !defined(EVE_SUPPORT_CMDB)
 	eve_assert(!phost->SpiWpWriting);
@@ -927,8 +934,88 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		/* not implemented */
 		eve_debug_break();
 	}
+	EVE_HalImpl_countBytes(phost, transferred);
 	return transferred;
 }
+
+/**
+ * @brief Write vectors to Coprocessor's memory, one SPI transaction per contiguous run
+ *
+ * The address header and all vectors of a run are clocked out under a single
+ * chip select, straight from the caller's buffers.
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	eve_assert(phost->Status == EVE_STATUS_OPENED);
+
+#if defined(EVE_BUFFER_WRITES)
+	/* Buffered writes go first */
+	if (!flush(phost))
+		return;
+#endif
+
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			uint32_t addr = v[0].Addr;
+			uint32_t sizeRemaining = size;
+			uint32_t sizeTransferred;
+			uint8_t hrdpkt[3];
+			FT_STATUS status;
+			size_t i;
+
+			++phost->Stats.Transfers;
+			phost->Stats.BytesWritten += size;
+
+			/* Compose the HOST MEMORY WRITE packet */
+			hrdpkt[0] = (addr >> 16) | 0x80; /* MSB bits 10 for WRITE */
+			hrdpkt[1] = (addr >> 8) & 0xFF;
+			hrdpkt[2] = addr & 0xFF;
+
+			status = SPI_Write((FT_HANDLE)phost->SpiHandle, hrdpkt, 3, &sizeTransferred, SPI_TRANSFER_OPTIONS_SIZE_IN_BYTES | SPI_TRANSFER_OPTIONS_CHIPSELECT_ENABLE);
+			if ((status != FT_OK) || (sizeTransferred != 3))
+			{
+				eve_printf_debug("%d SPI_Write failed, sizeTransferred is %d with status %d\n", __LINE__, sizeTransferred, (int)status);
+				phost->Status = EVE_STATUS_ERROR;
+				return;
+			}
+
+			for (i = 0; i < run; ++i)
+			{
+				const uint8_t *buffer = v[i].Buffer;
+				uint32_t bufferRemaining = v[i].Size;
+				while (bufferRemaining)
+				{
+					uint32_t transferSize = min(0xFFFF, bufferRemaining);
+					status = SPI_Write(phost->SpiHandle, (uint8 *)buffer, transferSize, &sizeTransferred,
+					    (transferSize == sizeRemaining) ? (SPI_TRANSFER_OPTIONS_SIZE_IN_BYTES | SPI_TRANSFER_OPTIONS_CHIPSELECT_DISABLE) : SPI_TRANSFER_OPTIONS_SIZE_IN_BYTES);
+					if (status != FT_OK || !sizeTransferred)
+					{
+						eve_printf_debug("%d SPI_Write failed, sizeTransferred is %d with status %d\n", __LINE__, sizeTransferred, (int)status);
+						phost->Status = EVE_STATUS_ERROR;
+						return;
+					}
+					bufferRemaining -= sizeTransferred;
+					sizeRemaining -= sizeTransferred;
+					buffer += sizeTransferred;
+				}
+			}
+
+#if defined(EVE_BUFFER_WRITES)
+			phost->SpiRamGAddr = incrementRamGAddr(phost, addr, size);
+#endif
+		}
+		v += run;
+		n -= run;
+	}
+}
 ///@}
 
 /************
@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 
+#define EVE_HALIMPL_BACKEND
 #include "EVE_HalImpl.h"
 #include "EVE_Platform.h"
 #if defined(EVE_MULTI_PLATFORM_TARGET)
@@ -37,6 +38,7 @@ static size_t s_TotalDeviceCount = 0;
 static size_t s_DeviceCountBT8XXEMU = 0;
 static size_t s_DeviceCountMPSSE = 0;
 static size_t s_DeviceCountFT4222 = 0;
+static size_t s_DeviceCountNULLDEV = 0;
 
 DWORD g_NumDevsD2XX = 0;
 
@@ -51,19 +53,23 @@ DWORD g_NumDevsD2XX = 0;
 void EVE_HalImpl_BT8XXEMU_initialize();
 void EVE_HalImpl_FT4222_initialize();
 void EVE_HalImpl_MPSSE_initialize();
+void EVE_HalImpl_NULLDEV_initialize();
 void EVE_HalImpl_initialize()
 {
 	EVE_HalImpl_BT8XXEMU_initialize();
 	EVE_HalImpl_MPSSE_initialize();
 	EVE_HalImpl_FT4222_initialize();
+	EVE_HalImpl_NULLDEV_initialize();
 }
 
 /* Release HAL platform */
 void EVE_HalImpl_BT8XXEMU_release();
 void EVE_HalImpl_FT4222_release();
 void EVE_HalImpl_MPSSE_release();
+void EVE_HalImpl_NULLDEV_release();
 void EVE_HalImpl_release()
 {
+	EVE_HalImpl_NULLDEV_release();
 	EVE_HalImpl_FT4222_release();
 	EVE_HalImpl_MPSSE_release();
 	EVE_HalImpl_BT8XXEMU_release();
@@ -72,18 +78,21 @@ void EVE_HalImpl_release()
 size_t EVE_Hal_BT8XXEMU_list();
 size_t EVE_Hal_FT4222_list();
 size_t EVE_Hal_MPSSE_list();
+size_t EVE_Hal_NULLDEV_list();
 size_t EVE_Hal_list()
 {
 	s_DeviceCountBT8XXEMU = EVE_Hal_BT8XXEMU_list();
 	s_DeviceCountMPSSE = EVE_Hal_MPSSE_list();
 	s_DeviceCountFT4222 = EVE_Hal_FT4222_list();
-	s_TotalDeviceCount = s_DeviceCountBT8XXEMU + s_DeviceCountMPSSE + s_DeviceCountFT4222;
+	s_DeviceCountNULLDEV = EVE_Hal_NULLDEV_list();
+	s_TotalDeviceCount = s_DeviceCountBT8XXEMU + s_DeviceCountMPSSE + s_DeviceCountFT4222 + s_DeviceCountNULLDEV;
 	return s_TotalDeviceCount;
 }
 
 void EVE_Hal_BT8XXEMU_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx);
 void EVE_Hal_FT4222_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx);
 void EVE_Hal_MPSSE_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx);
+void EVE_Hal_NULLDEV_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx);
 void EVE_Hal_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx)
 {
 	if (deviceIdx < s_DeviceCountBT8XXEMU)
@@ -98,6 +107,10 @@ void EVE_Hal_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx)
 	{
 		EVE_Hal_FT4222_info(deviceInfo, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE);
 	}
+	else if (deviceIdx < s_TotalDeviceCount)
+	{
+		EVE_Hal_NULLDEV_info(deviceInfo, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE - s_DeviceCountFT4222);
+	}
 	else
 	{
 		memset(deviceInfo, 0, sizeof(EVE_DeviceInfo));
@@ -108,6 +121,7 @@ void EVE_Hal_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx)
 bool EVE_Hal_BT8XXEMU_isDevice(EVE_HalContext *phost, size_t deviceIdx);
 bool EVE_Hal_FT4222_isDevice(EVE_HalContext *phost, size_t deviceIdx);
 bool EVE_Hal_MPSSE_isDevice(EVE_HalContext *phost, size_t deviceIdx);
+bool EVE_Hal_NULLDEV_isDevice(EVE_HalContext *phost, size_t deviceIdx);
 bool EVE_Hal_isDevice(EVE_HalContext *phost, size_t deviceIdx)
 {
 	if (deviceIdx < s_DeviceCountBT8XXEMU)
@@ -118,16 +132,21 @@ bool EVE_Hal_isDevice(EVE_HalContext *phost, size_t deviceIdx)
 	{
 		return EVE_Hal_MPSSE_isDevice(phost, deviceIdx - s_DeviceCountBT8XXEMU);
 	}
-	else
+	else if (deviceIdx < s_DeviceCountBT8XXEMU + s_DeviceCountMPSSE + s_DeviceCountFT4222)
 	{
 		return EVE_Hal_FT4222_isDevice(phost, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE);
 	}
+	else
+	{
+		return EVE_Hal_NULLDEV_isDevice(phost, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE - s_DeviceCountFT4222);
+	}
 }
 
 /* Get the default configuration parameters */
 bool EVE_HalImpl_BT8XXEMU_defaults(EVE_HalParameters *parameters, size_t deviceIdx);
 bool EVE_HalImpl_FT4222_defaults(EVE_HalParameters *parameters, size_t deviceIdx);
 bool EVE_HalImpl_MPSSE_defaults(EVE_HalParameters *parameters, size_t deviceIdx);
+bool EVE_HalImpl_NULLDEV_defaults(EVE_HalParameters *parameters, size_t deviceIdx);
 bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
 {
 	bool res;
@@ -146,6 +165,11 @@ bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
 		res = EVE_HalImpl_FT4222_defaults(parameters, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE);
 		parameters->Host = EVE_HOST_FT4222;
 	}
+	else if (deviceIdx < s_TotalDeviceCount)
+	{
+		res = EVE_HalImpl_NULLDEV_defaults(parameters, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE - s_DeviceCountFT4222);
+		parameters->Host = EVE_HOST_NULLDEV;
+	}
 	else if ((res = EVE_HalImpl_FT4222_defaults(parameters, deviceIdx - s_DeviceCountBT8XXEMU - s_DeviceCountMPSSE)))
 	{
 		parameters->Host = EVE_HOST_FT4222;
@@ -165,6 +189,7 @@ bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
 bool EVE_HalImpl_BT8XXEMU_open(EVE_HalContext *phost, const EVE_HalParameters *parameters);
 bool EVE_HalImpl_FT4222_open(EVE_HalContext *phost, const EVE_HalParameters *parameters);
 bool EVE_HalImpl_MPSSE_open(EVE_HalContext *phost, const EVE_HalParameters *parameters);
+bool EVE_HalImpl_NULLDEV_open(EVE_HalContext *phost, const EVE_HalParameters *parameters);
 bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters)
 {
 	bool res;
@@ -179,6 +204,9 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
 	case EVE_HOST_MPSSE:
 		res = EVE_HalImpl_MPSSE_open(phost, parameters);
 		break;
+	case EVE_HOST_NULLDEV:
+		res = EVE_HalImpl_NULLDEV_open(phost, parameters);
+		break;
 	default:
 		res = false;
 		break;
@@ -191,6 +219,7 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
 void EVE_HalImpl_BT8XXEMU_close(EVE_HalContext *phost);
 void EVE_HalImpl_FT4222_close(EVE_HalContext *phost);
 void EVE_HalImpl_MPSSE_close(EVE_HalContext *phost);
+void EVE_HalImpl_NULLDEV_close(EVE_HalContext *phost);
 void EVE_HalImpl_close(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -204,6 +233,9 @@ void EVE_HalImpl_close(EVE_HalContext *phost)
 	case EVE_HOST_MPSSE:
 		EVE_HalImpl_MPSSE_close(phost);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_HalImpl_NULLDEV_close(phost);
+		break;
 	default:
 		break;
 	}
@@ -213,6 +245,7 @@ void EVE_HalImpl_close(EVE_HalContext *phost)
 void EVE_HalImpl_BT8XXEMU_idle(EVE_HalContext *phost);
 void EVE_HalImpl_FT4222_idle(EVE_HalContext *phost);
 void EVE_HalImpl_MPSSE_idle(EVE_HalContext *phost);
+void EVE_HalImpl_NULLDEV_idle(EVE_HalContext *phost);
 void EVE_HalImpl_idle(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -226,6 +259,9 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
 	case EVE_HOST_MPSSE:
 		EVE_HalImpl_MPSSE_idle(phost);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_HalImpl_NULLDEV_idle(phost);
+		break;
 	default:
 		break;
 	}
@@ -242,6 +278,7 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
 void EVE_Hal_BT8XXEMU_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr);
 void EVE_Hal_FT4222_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr);
 void EVE_Hal_MPSSE_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr);
+void EVE_Hal_NULLDEV_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr);
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
 	switch (phost->Host)
@@ -255,6 +292,9 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_startTransfer(phost, rw, addr);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_startTransfer(phost, rw, addr);
+		break;
 	default:
 		break;
 	}
@@ -263,6 +303,7 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
 void EVE_Hal_BT8XXEMU_endTransfer(EVE_HalContext *phost);
 void EVE_Hal_FT4222_endTransfer(EVE_HalContext *phost);
 void EVE_Hal_MPSSE_endTransfer(EVE_HalContext *phost);
+void EVE_Hal_NULLDEV_endTransfer(EVE_HalContext *phost);
 void EVE_Hal_endTransfer(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -276,6 +317,9 @@ void EVE_Hal_endTransfer(EVE_HalContext *phost)
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_endTransfer(phost);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_endTransfer(phost);
+		break;
 	default:
 		break;
 	}
@@ -284,6 +328,7 @@ void EVE_Hal_endTransfer(EVE_HalContext *phost)
 void EVE_Hal_BT8XXEMU_flush(EVE_HalContext *phost);
 void EVE_Hal_FT4222_flush(EVE_HalContext *phost);
 void EVE_Hal_MPSSE_flush(EVE_HalContext *phost);
+void EVE_Hal_NULLDEV_flush(EVE_HalContext *phost);
 void EVE_Hal_flush(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -297,6 +342,9 @@ void EVE_Hal_flush(EVE_HalContext *phost)
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_flush(phost);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_flush(phost);
+		break;
 	default:
 		break;
 	}
@@ -305,6 +353,7 @@ void EVE_Hal_flush(EVE_HalContext *phost)
 uint8_t EVE_Hal_BT8XXEMU_transfer8(EVE_HalContext *phost, uint8_t value);
 uint8_t EVE_Hal_FT4222_transfer8(EVE_HalContext *phost, uint8_t value);
 uint8_t EVE_Hal_MPSSE_transfer8(EVE_HalContext *phost, uint8_t value);
+uint8_t EVE_Hal_NULLDEV_transfer8(EVE_HalContext *phost, uint8_t value);
 uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 {
 	switch (phost->Host)
@@ -315,6 +364,8 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 		return EVE_Hal_FT4222_transfer8(phost, value);
 	case EVE_HOST_MPSSE:
 		return EVE_Hal_MPSSE_transfer8(phost, value);
+	case EVE_HOST_NULLDEV:
+		return EVE_Hal_NULLDEV_transfer8(phost, value);
 	default:
 		break;
 	}
@@ -324,6 +375,7 @@ uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
 uint16_t EVE_Hal_BT8XXEMU_transfer16(EVE_HalContext *phost, uint16_t value);
 uint16_t EVE_Hal_FT4222_transfer16(EVE_HalContext *phost, uint16_t value);
 uint16_t EVE_Hal_MPSSE_transfer16(EVE_HalContext *phost, uint16_t value);
+uint16_t EVE_Hal_NULLDEV_transfer16(EVE_HalContext *phost, uint16_t value);
 uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 {
 	switch (phost->Host)
@@ -334,6 +386,8 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 		return EVE_Hal_FT4222_transfer16(phost, value);
 	case EVE_HOST_MPSSE:
 		return EVE_Hal_MPSSE_transfer16(phost, value);
+	case EVE_HOST_NULLDEV:
+		return EVE_Hal_NULLDEV_transfer16(phost, value);
 	default:
 		break;
 	}
@@ -343,6 +397,7 @@ uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
 uint32_t EVE_Hal_BT8XXEMU_transfer32(EVE_HalContext *phost, uint32_t value);
 uint32_t EVE_Hal_FT4222_transfer32(EVE_HalContext *phost, uint32_t value);
 uint32_t EVE_Hal_MPSSE_transfer32(EVE_HalContext *phost, uint32_t value);
+uint32_t EVE_Hal_NULLDEV_transfer32(EVE_HalContext *phost, uint32_t value);
 uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 {
 	switch (phost->Host)
@@ -353,6 +408,8 @@ uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 		return EVE_Hal_FT4222_transfer32(phost, value);
 	case EVE_HOST_MPSSE:
 		return EVE_Hal_MPSSE_transfer32(phost, value);
+	case EVE_HOST_NULLDEV:
+		return EVE_Hal_NULLDEV_transfer32(phost, value);
 	default:
 		break;
 	}
@@ -362,6 +419,7 @@ uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
 void EVE_Hal_BT8XXEMU_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size);
 void EVE_Hal_FT4222_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size);
 void EVE_Hal_MPSSE_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size);
+void EVE_Hal_NULLDEV_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size);
 void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size)
 {
 	switch (phost->Host)
@@ -375,6 +433,9 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_transferMem(phost, result, buffer, size);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_transferMem(phost, result, buffer, size);
+		break;
 	default:
 		break;
 	}
@@ -383,6 +444,7 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 void EVE_Hal_BT8XXEMU_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
 void EVE_Hal_FT4222_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
 void EVE_Hal_MPSSE_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
+void EVE_Hal_NULLDEV_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
 void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size)
 {
 	switch (phost->Host)
@@ -396,6 +458,9 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_transferProgMem(phost, result, buffer, size);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_transferProgMem(phost, result, buffer, size);
+		break;
 	default:
 		break;
 	}
@@ -404,6 +469,7 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 uint32_t EVE_Hal_BT8XXEMU_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 uint32_t EVE_Hal_FT4222_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 uint32_t EVE_Hal_MPSSE_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
+uint32_t EVE_Hal_NULLDEV_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask)
 {
 	switch (phost->Host)
@@ -414,11 +480,38 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 		return EVE_Hal_FT4222_transferString(phost, str, index, size, padMask);
 	case EVE_HOST_MPSSE:
 		return EVE_Hal_MPSSE_transferString(phost, str, index, size, padMask);
+	case EVE_HOST_NULLDEV:
+		return EVE_Hal_NULLDEV_transferString(phost, str, index, size, padMask);
 	default:
 		break;
 	}
 	return 0;
 }
+
+void EVE_HalImpl_BT8XXEMU_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+void EVE_HalImpl_FT4222_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+void EVE_HalImpl_MPSSE_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+void EVE_HalImpl_NULLDEV_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	switch (phost->Host)
+	{
+	case EVE_HOST_BT8XXEMU:
+		EVE_HalImpl_BT8XXEMU_wrv(phost, v, n);
+		break;
+	case EVE_HOST_FT4222:
+		EVE_HalImpl_FT4222_wrv(phost, v, n);
+		break;
+	case EVE_HOST_MPSSE:
+		EVE_HalImpl_MPSSE_wrv(phost, v, n);
+		break;
+	case EVE_HOST_NULLDEV:
+		EVE_HalImpl_NULLDEV_wrv(phost, v, n);
+		break;
+	default:
+		break;
+	}
+}
 ///@}
 
 /************
@@ -431,6 +524,7 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
 void EVE_Hal_BT8XXEMU_hostCommand(EVE_HalContext *phost, uint8_t cmd);
 void EVE_Hal_FT4222_hostCommand(EVE_HalContext *phost, uint8_t cmd);
 void EVE_Hal_MPSSE_hostCommand(EVE_HalContext *phost, uint8_t cmd);
+void EVE_Hal_NULLDEV_hostCommand(EVE_HalContext *phost, uint8_t cmd);
 void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
 {
 	switch (phost->Host)
@@ -444,6 +538,9 @@ void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_hostCommand(phost, cmd);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_hostCommand(phost, cmd);
+		break;
 	default:
 		break;
 	}
@@ -453,6 +550,7 @@ void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
 void EVE_Hal_BT8XXEMU_hostCommandExt3(EVE_HalContext *phost, uint8_t cmd);
 void EVE_Hal_FT4222_hostCommandExt3(EVE_HalContext *phost, uint8_t cmd);
 void EVE_Hal_MPSSE_hostCommandExt3(EVE_HalContext *phost, uint8_t cmd);
+void EVE_Hal_NULLDEV_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd);
 void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
 {
 	switch (phost->Host)
@@ -466,6 +564,9 @@ void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_hostCommandExt3(phost, cmd);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_hostCommandExt3(phost, cmd);
+		break;
 	default:
 		break;
 	}
@@ -475,6 +576,7 @@ void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
 bool EVE_Hal_BT8XXEMU_powerCycle(EVE_HalContext *phost, bool up);
 bool EVE_Hal_FT4222_powerCycle(EVE_HalContext *phost, bool up);
 bool EVE_Hal_MPSSE_powerCycle(EVE_HalContext *phost, bool up);
+bool EVE_Hal_NULLDEV_powerCycle(EVE_HalContext *phost, bool up);
 bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 {
 	switch (phost->Host)
@@ -488,6 +590,9 @@ bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 	case EVE_HOST_MPSSE:
 		return EVE_Hal_MPSSE_powerCycle(phost, up);
 		break;
+	case EVE_HOST_NULLDEV:
+		return EVE_Hal_NULLDEV_powerCycle(phost, up);
+		break;
 	default:
 		break;
 	}
@@ -497,6 +602,7 @@ bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 void EVE_Hal_BT8XXEMU_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy);
 void EVE_Hal_FT4222_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy);
 void EVE_Hal_MPSSE_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy);
+void EVE_Hal_NULLDEV_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy);
 void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy)
 {
 	switch (phost->Host)
@@ -510,6 +616,9 @@ void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_setSPI(phost, numchnls, numdummy);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_setSPI(phost, numchnls, numdummy);
+		break;
 	default:
 		break;
 	}
@@ -518,6 +627,7 @@ void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t
 void EVE_Hal_BT8XXEMU_restoreSPI(EVE_HalContext *phost);
 void EVE_Hal_FT4222_restoreSPI(EVE_HalContext *phost);
 void EVE_Hal_MPSSE_restoreSPI(EVE_HalContext *phost);
+void EVE_Hal_NULLDEV_restoreSPI(EVE_HalContext *phost);
 void EVE_Hal_restoreSPI(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -531,6 +641,9 @@ void EVE_Hal_restoreSPI(EVE_HalContext *phost)
 	case EVE_HOST_MPSSE:
 		EVE_Hal_MPSSE_restoreSPI(phost);
 		break;
+	case EVE_HOST_NULLDEV:
+		EVE_Hal_NULLDEV_restoreSPI(phost);
+		break;
 	default:
 		break;
 	}
@@ -547,6 +660,7 @@ void EVE_Hal_restoreSPI(EVE_HalContext *phost)
 bool EVE_UtilImpl_BT8XXEMU_bootupDisplayGpio(EVE_HalContext *phost);
 bool EVE_UtilImpl_FT4222_bootupDisplayGpio(EVE_HalContext *phost);
 bool EVE_UtilImpl_MPSSE_bootupDisplayGpio(EVE_HalContext *phost);
+bool EVE_UtilImpl_NULLDEV_bootupDisplayGpio(EVE_HalContext *phost);
 bool EVE_UtilImpl_bootupDisplayGpio(EVE_HalContext *phost)
 {
 	switch (phost->Host)
@@ -557,6 +671,8 @@ bool EVE_UtilImpl_bootupDisplayGpio(EVE_HalContext *phost)
 		return EVE_UtilImpl_FT4222_bootupDisplayGpio(phost);
 	case EVE_HOST_MPSSE:
 		return EVE_UtilImpl_MPSSE_bootupDisplayGpio(phost);
+	case EVE_HOST_NULLDEV:
+		return EVE_UtilImpl_NULLDEV_bootupDisplayGpio(phost);
 	default:
 		break;
 	}
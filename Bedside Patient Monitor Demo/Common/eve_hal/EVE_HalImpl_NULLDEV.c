@@ -0,0 +1,762 @@
+/**
+ * @file EVE_HalImpl_NULLDEV.c
+ * @brief Eve_Hal framework APIs for a headless software device
+ *
+ * The NULLDEV backend stands in for an EVE device without any hardware
+ * or emulator library. It models RAM_G, the register file, RAM_DL and the
+ * command FIFO. The coprocessor executes instantly: the read pointer
+ * follows the write pointer as soon as a write transfer ends, the media
+ * FIFO is drained likewise, and REG_CMDB_SPACE always reports a free
+ * FIFO. Nothing is rendered and no coprocessor command is interpreted,
+ * results written by the coprocessor read back as the values written
+ * by the host.
+ *
+ * Use this to run an application loop at maximum speed and measure
+ * the host-side CPU cost, for example on a build server.
+ * Select with EVE_PLATFORM_NULLDEV.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(EVE_MULTI_PLATFORM_TARGET)
+/* Exported under prefixed names for EVE_HalImpl_MULTI.c */
+#define EVE_HalImpl_initialize EVE_HalImpl_NULLDEV_initialize
+#define EVE_HalImpl_release EVE_HalImpl_NULLDEV_release
+#define EVE_HalImpl_defaults EVE_HalImpl_NULLDEV_defaults
+#define EVE_HalImpl_open EVE_HalImpl_NULLDEV_open
+#define EVE_HalImpl_close EVE_HalImpl_NULLDEV_close
+#define EVE_HalImpl_idle EVE_HalImpl_NULLDEV_idle
+#define EVE_Hal_list EVE_Hal_NULLDEV_list
+#define EVE_Hal_info EVE_Hal_NULLDEV_info
+#define EVE_Hal_isDevice EVE_Hal_NULLDEV_isDevice
+#define EVE_Hal_startTransfer EVE_Hal_NULLDEV_startTransfer
+#define EVE_Hal_endTransfer EVE_Hal_NULLDEV_endTransfer
+#define EVE_Hal_flush EVE_Hal_NULLDEV_flush
+#define EVE_HalImpl_wrv EVE_HalImpl_NULLDEV_wrv
+#define EVE_Hal_transfer8 EVE_Hal_NULLDEV_transfer8
+#define EVE_Hal_transfer16 EVE_Hal_NULLDEV_transfer16
+#define EVE_Hal_transfer32 EVE_Hal_NULLDEV_transfer32
+#define EVE_Hal_transferMem EVE_Hal_NULLDEV_transferMem
+#define EVE_Hal_transferProgMem EVE_Hal_NULLDEV_transferProgMem
+#define EVE_Hal_transferString EVE_Hal_NULLDEV_transferString
+#define EVE_Hal_hostCommand EVE_Hal_NULLDEV_hostCommand
+#define EVE_Hal_hostCommandExt3 EVE_Hal_NULLDEV_hostCommandExt3
+#define EVE_Hal_powerCycle EVE_Hal_NULLDEV_powerCycle
+#define EVE_Hal_setSPI EVE_Hal_NULLDEV_setSPI
+#define EVE_Hal_restoreSPI EVE_Hal_NULLDEV_restoreSPI
+#define EVE_UtilImpl_bootupDisplayGpio EVE_UtilImpl_NULLDEV_bootupDisplayGpio
+#else
+#define EVE_HALIMPL_BACKEND
+#endif
+#include "EVE_HalImpl.h"
+#include "EVE_Platform.h"
+#if defined(NULLDEV_PLATFORM) || defined(EVE_MULTI_PLATFORM_TARGET)
+
+/** Size of the modelled memory starting at RAM_DL.
+Covers the display list, the register file, the command FIFO,
+and the tracker and media FIFO registers */
+#define NULLDEV_RAM_DL_SIZE (64 * 1024UL)
+
+/** State of the software device */
+typedef struct EVE_NullDev
+{
+	uint8_t RamG[RAM_G_SIZE];
+	uint8_t RamDl[NULLDEV_RAM_DL_SIZE];
+	uint8_t RomChipId[4];
+
+	uint32_t Addr; /**< Current address of the ongoing transfer */
+	uint32_t StartAddr; /**< Start address of the ongoing transfer */
+	uint32_t CmdbBytes; /**< Bytes written to REG_CMDB_WRITE in the ongoing transfer */
+	bool Cmdb; /**< The ongoing transfer writes to REG_CMDB_WRITE */
+
+	uint32_t StartMillis; /**< Time of the last power cycle */
+} EVE_NullDev;
+
+/**********
+** MODEL **
+**********/
+
+/** @name MODEL */
+///@{
+
+/**
+ * @brief Get the modelled memory at an address
+ *
+ * @param dev Software device
+ * @param addr Device address
+ * @param write True when writing, ROM is not writable
+ * @param avail Receives the number of contiguous bytes available from the address
+ * @return uint8_t* Pointer to the memory, NULL if the address is not modelled
+ */
+static inline uint8_t *memAt(EVE_NullDev *dev, uint32_t addr, bool write, uint32_t *avail)
+{
+	if (addr < RAM_G_SIZE)
+	{
+		*avail = RAM_G_SIZE - addr;
+		return &dev->RamG[addr];
+	}
+	if (addr - RAM_DL < NULLDEV_RAM_DL_SIZE)
+	{
+		*avail = NULLDEV_RAM_DL_SIZE - (addr - RAM_DL);
+		return &dev->RamDl[addr - RAM_DL];
+	}
+	if (!write && addr - ROM_CHIPID < 4)
+	{
+		*avail = 4 - (addr - ROM_CHIPID);
+		return &dev->RomChipId[addr - ROM_CHIPID];
+	}
+	*avail = 0;
+	return NULL;
+}
+
+/**
+ * @brief Read a register of the software device
+ *
+ * @param dev Software device
+ * @param addr Register address
+ * @return uint32_t Register value
+ */
+static inline uint32_t rdReg(EVE_NullDev *dev, uint32_t addr)
+{
+	const uint8_t *p = &dev->RamDl[addr - RAM_DL];
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Write a register of the software device
+ *
+ * @param dev Software device
+ * @param addr Register address
+ * @param value Register value
+ */
+static inline void wrReg(EVE_NullDev *dev, uint32_t addr, uint32_t value)
+{
+	uint8_t *p = &dev->RamDl[addr - RAM_DL];
+	p[0] = value & 0xFF;
+	p[1] = (value >> 8) & 0xFF;
+	p[2] = (value >> 16) & 0xFF;
+	p[3] = value >> 24;
+}
+
+/**
+ * @brief Check if the ongoing write transfer covered a register
+ *
+ * @param dev Software device
+ * @param addr Register address
+ * @return true True if any byte of the register was written
+ */
+static inline bool wroteReg(EVE_NullDev *dev, uint32_t addr)
+{
+	return dev->StartAddr < addr + 4 && addr < dev->Addr;
+}
+
+/**
+ * @brief Reset the software device to its power on state
+ *
+ * @param dev Software device
+ */
+static void resetDevice(EVE_NullDev *dev)
+{
+	const int chipId = EVE_shortChipId(EVE_CHIPID);
+	uint8_t *romChipId;
+	uint32_t avail;
+
+	memset(dev, 0, sizeof(EVE_NullDev));
+
+	/* ROM_CHIPID holds the chip id in big endian, followed by the version.
+	On devices with 1MB RAM_G it is initialized in RAM_G at bootup */
+	romChipId = memAt(dev, ROM_CHIPID, false, &avail);
+	romChipId[0] = (chipId >> 8) & 0xFF;
+	romChipId[1] = chipId & 0xFF;
+	romChipId[2] = 1;
+	romChipId[3] = 0;
+
+	dev->RamDl[REG_ID - RAM_DL] = 0x7C;
+	wrReg(dev, REG_FREQUENCY, EVE_CHIPID >= EVE_FT810 ? 60000000UL : 48000000UL);
+	wrReg(dev, REG_TOUCH_SCREEN_XY, 0x80008000UL);
+#if defined(EVE_SUPPORT_FLASH)
+	/* There is no flash model, report it as ready for use */
+	wrReg(dev, REG_FLASH_STATUS, FLASH_STATUS_FULL);
+#endif
+	dev->StartMillis = EVE_millis();
+}
+
+/**
+ * @brief Update the registers which change by themselves, before reading
+ *
+ * @param dev Software device
+ */
+static void updateRegisters(EVE_NullDev *dev)
+{
+	uint32_t millis = EVE_millis() - dev->StartMillis;
+	uint32_t freq = rdReg(dev, REG_FREQUENCY);
+
+	wrReg(dev, REG_CLOCK, millis * (freq / 1000));
+	wrReg(dev, REG_FRAMES, millis * 60 / 1000);
+#if defined(EVE_SUPPORT_CMDB)
+	wrReg(dev, REG_CMDB_SPACE, (rdReg(dev, REG_CMD_READ) - rdReg(dev, REG_CMD_WRITE) - 4) & EVE_CMD_FIFO_MASK);
+#endif
+}
+
+/**
+ * @brief Apply the effects of a completed write transfer
+ *
+ * @param dev Software device
+ */
+static void updateWrite(EVE_NullDev *dev)
+{
+	if (dev->Cmdb)
+	{
+		uint32_t wp = (rdReg(dev, REG_CMD_WRITE) + dev->CmdbBytes) & EVE_CMD_FIFO_MASK;
+		wrReg(dev, REG_CMD_WRITE, wp);
+	}
+	else if (wroteReg(dev, REG_DLSWAP))
+	{
+		/* Swap completes immediately */
+		wrReg(dev, REG_DLSWAP, 0);
+	}
+
+	/* The coprocessor executes everything instantly, unless held in reset */
+	if (!(dev->RamDl[REG_CPURESET - RAM_DL] & 0x01))
+	{
+		wrReg(dev, REG_CMD_READ, rdReg(dev, REG_CMD_WRITE) & EVE_CMD_FIFO_MASK);
+#if defined(EVE_SUPPORT_MEDIAFIFO)
+		wrReg(dev, REG_MEDIAFIFO_READ, rdReg(dev, REG_MEDIAFIFO_WRITE));
+#endif
+	}
+}
+///@}
+
+/*********
+** INIT **
+*********/
+
+/** @name INIT */
+///@{
+
+/**
+ * @brief Initialize HAL platform
+ *
+ */
+void EVE_HalImpl_initialize()
+{
+	/* no-op */
+}
+
+/**
+ * @brief Release HAL platform
+ *
+ */
+void EVE_HalImpl_release()
+{
+	/* no-op */
+}
+
+/**
+ * @brief List the available devices
+ *
+ * @return 1
+ */
+size_t EVE_Hal_list()
+{
+	return 1;
+}
+
+/**
+ * @brief Get info of the specified device
+ *
+ * @param deviceInfo
+ * @param deviceIdx
+ */
+void EVE_Hal_info(EVE_DeviceInfo *deviceInfo, size_t deviceIdx)
+{
+	(void)deviceIdx;
+	memset(deviceInfo, 0, sizeof(EVE_DeviceInfo));
+	strncpy(deviceInfo->DisplayName, "Null Device", sizeof(deviceInfo->DisplayName) - 1);
+	strncpy(deviceInfo->SerialNumber, "NULLDEV", sizeof(deviceInfo->SerialNumber) - 1);
+	deviceInfo->Opened = false; // Can be opened multiple times
+	deviceInfo->Host = EVE_HOST_NULLDEV;
+}
+
+/**
+ * @brief Check whether the context is the specified device
+ *
+ * @param phost Pointer to Hal context
+ * @param deviceIdx
+ * @return true
+ */
+bool EVE_Hal_isDevice(EVE_HalContext *phost, size_t deviceIdx)
+{
+	(void)deviceIdx;
+	if (!phost)
+		return false;
+	return phost->NullDev != NULL;
+}
+
+/**
+ * @brief Get the default configuration parameters
+ *
+ * @param parameters EVE_Hal framework's parameters
+ * @param deviceIdx
+ * @return true
+ */
+bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
+{
+	(void)parameters;
+	(void)deviceIdx;
+	return true;
+}
+
+/**
+ * @brief Opens a new HAL context using the specified parameters
+ *
+ * @param phost Pointer to Hal context
+ * @param parameters EVE_Hal framework's parameters
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters)
+{
+	EVE_NullDev *dev = malloc(sizeof(EVE_NullDev));
+	(void)parameters;
+	if (!dev)
+		return false;
+	resetDevice(dev);
+	phost->NullDev = dev;
+
+	phost->Status = EVE_STATUS_OPENED;
+	++g_HalPlatform.OpenedDevices;
+	return true;
+}
+
+/**
+ * @brief Close a HAL context
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_HalImpl_close(EVE_HalContext *phost)
+{
+	free(phost->NullDev);
+	phost->NullDev = NULL;
+
+	phost->Status = EVE_STATUS_CLOSED;
+	--g_HalPlatform.OpenedDevices;
+}
+
+/**
+ * @brief Idle. Call regularly to update frequently changing internal state
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_HalImpl_idle(EVE_HalContext *phost)
+{
+	(void)phost; /* no-op */
+}
+///@}
+
+/*************
+** TRANSFER **
+*************/
+
+/** @name TRANSFER */
+///@{
+
+/**
+ * @brief Start data transfer to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param rw Read or Write
+ * @param addr Address to read/write
+ */
+void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
+{
+	EVE_NullDev *dev = phost->NullDev;
+	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	++phost->Stats.Transfers;
+
+	dev->Addr = addr & 0x3FFFFF;
+	dev->StartAddr = dev->Addr;
+	dev->CmdbBytes = 0;
+	if (rw == EVE_TRANSFER_READ)
+	{
+		dev->Cmdb = false;
+		updateRegisters(dev);
+		phost->Status = EVE_STATUS_READING;
+	}
+	else
+	{
+#if defined(EVE_SUPPORT_CMDB)
+		dev->Cmdb = dev->Addr == REG_CMDB_WRITE;
+#else
+		dev->Cmdb = false;
+#endif
+		phost->Status = EVE_STATUS_WRITING;
+	}
+}
+
+/**
+ * @brief End data transfer
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_endTransfer(EVE_HalContext *phost)
+{
+	eve_assert(phost->Status == EVE_STATUS_READING || phost->Status == EVE_STATUS_WRITING);
+
+	if (phost->Status == EVE_STATUS_WRITING)
+		updateWrite(phost->NullDev);
+	phost->Status = EVE_STATUS_OPENED;
+}
+
+/**
+ * @brief Flush data to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_flush(EVE_HalContext *phost)
+{
+	eve_assert(phost->Status == EVE_STATUS_OPENED);
+	/* no-op */
+}
+
+/**
+ * @brief Transfer a block of data to or from the software device
+ *
+ * @param phost Pointer to Hal context
+ * @param result Buffer to get data transfered, NULL when write
+ * @param buffer Buffer where data is transfered, NULL when read
+ * @param size Size of buffer
+ */
+static void transferBlock(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size)
+{
+	EVE_NullDev *dev = phost->NullDev;
+
+	if (phost->Status == EVE_STATUS_READING)
+	{
+		while (size)
+		{
+			uint32_t avail;
+			uint8_t *p = memAt(dev, dev->Addr, false, &avail);
+			uint32_t chunk = p ? min(size, avail) : 1;
+			if (result)
+			{
+				if (p)
+					memcpy(result, p, chunk);
+				else
+					*result = 0;
+				result += chunk;
+			}
+			dev->Addr += chunk;
+			size -= chunk;
+		}
+	}
+	else if (dev->Cmdb)
+	{
+		/* Append to the command FIFO, wrapping around */
+		while (size)
+		{
+			uint32_t wp = (rdReg(dev, REG_CMD_WRITE) + dev->CmdbBytes) & EVE_CMD_FIFO_MASK;
+			uint32_t chunk = min(size, EVE_CMD_FIFO_SIZE - wp);
+			memcpy(&dev->RamDl[RAM_CMD - RAM_DL + wp], buffer, chunk);
+			dev->CmdbBytes += chunk;
+			buffer += chunk;
+			size -= chunk;
+		}
+	}
+	else
+	{
+		while (size)
+		{
+			uint32_t avail;
+			uint8_t *p = memAt(dev, dev->Addr, true, &avail);
+			uint32_t chunk = p ? min(size, avail) : 1;
+			if (p)
+				memcpy(p, buffer, chunk);
+			dev->Addr += chunk;
+			buffer += chunk;
+			size -= chunk;
+		}
+	}
+}
+
+/**
+ * @brief Write 8 bits to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param value Value to write
+ * @return uint8_t Number of bytes transfered
+ */
+uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
+{
+	uint8_t res = 0;
+	EVE_HalImpl_countBytes(phost, 1);
+	transferBlock(phost, &res, &value, 1);
+	return res;
+}
+
+/**
+ * @brief Write 2 bytes to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param value Value to write
+ * @return uint16_t Number of bytes transfered
+ */
+uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
+{
+	uint8_t buffer[2];
+	uint8_t res[2] = { 0 };
+	EVE_HalImpl_countBytes(phost, 2);
+	buffer[0] = value & 0xFF;
+	buffer[1] = value >> 8;
+	transferBlock(phost, res, buffer, 2);
+	return (uint16_t)res[0] | ((uint16_t)res[1] << 8);
+}
+
+/**
+ * @brief Write 4 bytes to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param value Value to write
+ * @return uint32_t Number of bytes transfered
+ */
+uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
+{
+	uint8_t buffer[4];
+	uint8_t res[4] = { 0 };
+	EVE_HalImpl_countBytes(phost, 4);
+	buffer[0] = value & 0xFF;
+	buffer[1] = (value >> 8) & 0xFF;
+	buffer[2] = (value >> 16) & 0xFF;
+	buffer[3] = value >> 24;
+	transferBlock(phost, res, buffer, 4);
+	return (uint32_t)res[0] | ((uint32_t)res[1] << 8) | ((uint32_t)res[2] << 16) | ((uint32_t)res[3] << 24);
+}
+
+/**
+ * @brief Transfer (read/write) a block data to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param result Buffer to get data transfered, NULL when write
+ * @param buffer Buffer where data is transfered, NULL when read
+ * @param size Size of buffer
+ */
+void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size)
+{
+	EVE_HalImpl_countBytes(phost, size);
+	transferBlock(phost, result, buffer, size);
+}
+
+/**
+ * @brief Transfer a block data from program memory
+ *
+ * @param phost Pointer to Hal context
+ * @param result Buffer to get data transfered, NULL when write
+ * @param buffer Buffer where data is transfered, NULL when read
+ * @param size Size of buffer
+ */
+void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size)
+{
+	EVE_HalImpl_countBytes(phost, size);
+	transferBlock(phost, result, buffer, size);
+}
+
+/**
+ * @brief Transfer a string to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param str String to transfer
+ * @param index Start position in the string
+ * @param size Size of string
+ * @param padMask Padding mask
+ * @return uint32_t Numer of bytes transfered
+ */
+uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask)
+{
+	uint8_t buffer[EVE_CMD_STRING_MAX + 4];
+	uint32_t transferred = 0;
+
+	if (!size)
+	{
+		/* TODO: Support different padding options */
+		eve_assert(padMask == 0x3);
+		EVE_Hal_transfer32(phost, 0);
+		return 4;
+	}
+
+	eve_assert(size <= EVE_CMD_STRING_MAX);
+	if (phost->Status == EVE_STATUS_WRITING)
+	{
+		for (;;)
+		{
+			char c = str[index + (transferred)];
+			buffer[transferred++] = c;
+			if (!c)
+			{
+				break;
+			}
+			if (transferred >= size)
+			{
+				buffer[transferred++] = 0;
+				break;
+			}
+		}
+		while (transferred & padMask)
+		{
+			buffer[transferred++] = 0;
+		}
+
+		transferBlock(phost, NULL, buffer, transferred);
+	}
+	else
+	{
+		/* not implemented */
+		eve_debug_break();
+	}
+	EVE_HalImpl_countBytes(phost, transferred);
+	return transferred;
+}
+
+/**
+ * @brief Write vectors to Coprocessor's memory, one transfer per contiguous run
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write, in write order
+ * @param n Number of vectors
+ */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	while (n)
+	{
+		uint32_t size;
+		size_t run = EVE_HalImpl_wrvRun(v, n, &size);
+		if (size)
+		{
+			size_t i;
+			EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, v[0].Addr);
+			phost->Stats.BytesWritten += size;
+			for (i = 0; i < run; ++i)
+				transferBlock(phost, NULL, v[i].Buffer, v[i].Size);
+			EVE_Hal_endTransfer(phost);
+		}
+		v += run;
+		n -= run;
+	}
+}
+///@}
+
+/************
+** UTILITY **
+************/
+
+/** @name UTILITY */
+///@{
+
+/**
+ * @brief Send a host command to Coprocessor
+ *
+ * @param phost Pointer to Hal context
+ * @param cmd Command to send
+ */
+void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
+{
+	(void)phost; /* no-op */
+	(void)cmd;
+}
+
+/**
+ * @brief This API sends a 3byte command to the phost
+ *
+ * @param phost Pointer to Hal context
+ * @param cmd Command to send
+ */
+void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
+{
+	(void)phost; /* no-op */
+	(void)cmd;
+}
+
+/**
+ * @brief Power cycle the software device, resets all memory and registers
+ *
+ * @param phost Pointer to Hal context
+ * @param up Up or Down
+ */
+bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
+{
+	if (up)
+		resetDevice(phost->NullDev);
+	return true;
+}
+
+/**
+ * @brief Set number of SPI channel
+ *
+ * @param phost Pointer to Hal context
+ * @param numchnls Number of channel
+ * @param numdummy Number of dummy bytes
+ */
+void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy)
+{
+	phost->SpiChannels = numchnls;
+	phost->SpiDummyBytes = numdummy;
+}
+
+/**
+ * @brief Restore platform to previously configured EVE SPI channel mode
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_restoreSPI(EVE_HalContext *phost)
+{
+	(void)phost; /* no-op */
+}
+///@}
+
+/*********
+** MISC **
+*********/
+
+/** @name MISC */
+///@{
+
+/**
+ * @brief Display GPIO pins
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if Ok
+ * @return false False if error
+ */
+bool EVE_UtilImpl_bootupDisplayGpio(EVE_HalContext *phost)
+{
+	(void)phost; /* no-op */
+	return true;
+}
+///@}
+
+#endif /* #if defined(NULLDEV_PLATFORM) || defined(EVE_MULTI_PLATFORM_TARGET) */
+
+/* end of file */
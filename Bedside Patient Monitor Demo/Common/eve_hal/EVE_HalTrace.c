@@ -0,0 +1,422 @@
+/**
+ * @file EVE_HalTrace.c
+ * @brief Transport trace recorder and replayer
+ *
+ * When EVE_HAL_TRACE is enabled, the backends implement their transfer
+ * functions under the EVE_HalImpl_* names, and this file provides the
+ * public EVE_Hal_* transfer functions which record the traffic.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_HalImpl.h"
+#include "EVE_Platform.h"
+#if EVE_HAL_TRACE
+
+#include <stdio.h>
+
+/*************
+** RECORDER **
+*************/
+
+/** @name Recorder */
+///@{
+
+/**
+ * @brief Write a little endian value to the trace file
+ *
+ * @param f Trace file
+ * @param value Value to write
+ * @param size Number of bytes to write
+ */
+static void writeValue(FILE *f, uint32_t value, int size)
+{
+	int i;
+	for (i = 0; i < size; ++i)
+		fputc((value >> (i * 8)) & 0xFF, f);
+}
+
+/**
+ * @brief Write the pending payload of the current transfer to the trace file
+ *
+ * @param phost Pointer to Hal context
+ */
+static void flushData(EVE_HalContext *phost)
+{
+	FILE *f = (FILE *)phost->TraceFile;
+	if (!phost->TraceDataIndex)
+		return;
+	fputc(EVE_HAL_TRACE_DATA, f);
+	writeValue(f, phost->TraceDataIndex, 2);
+	fwrite(phost->TraceData, 1, phost->TraceDataIndex, f);
+	phost->TraceDataIndex = 0;
+}
+
+/**
+ * @brief Append payload of the current transfer
+ *
+ * @param phost Pointer to Hal context
+ * @param data Bytes that were written or read
+ * @param size Number of bytes
+ */
+static void traceData(EVE_HalContext *phost, const uint8_t *data, uint32_t size)
+{
+	if (!phost->TraceFile)
+		return;
+	while (size)
+	{
+		uint32_t chunk = min(size, (uint32_t)(EVE_HAL_TRACE_BUFFER - phost->TraceDataIndex));
+		memcpy(&phost->TraceData[phost->TraceDataIndex], data, chunk);
+		phost->TraceDataIndex += (uint16_t)chunk;
+		data += chunk;
+		size -= chunk;
+		if (phost->TraceDataIndex == EVE_HAL_TRACE_BUFFER)
+			flushData(phost);
+	}
+}
+
+/**
+ * @brief Append a value of the current transfer, in wire order
+ *
+ * @param phost Pointer to Hal context
+ * @param value Value that was written or read
+ * @param size Number of bytes
+ */
+static void traceValue(EVE_HalContext *phost, uint32_t value, int size)
+{
+	uint8_t buffer[4];
+	int i;
+	for (i = 0; i < size; ++i)
+		buffer[i] = (value >> (i * 8)) & 0xFF;
+	traceData(phost, buffer, size);
+}
+
+/**
+ * @brief Start recording all transfers to a file
+ *
+ * @param phost Pointer to Hal context
+ * @param filename File to record to
+ * @return true True if ok
+ * @return false False if the file cannot be created
+ */
+bool EVE_HalTrace_start(EVE_HalContext *phost, const char *filename)
+{
+	FILE *f;
+	eve_assert(phost->Status == EVE_STATUS_OPENED);
+
+	EVE_HalTrace_stop(phost);
+	f = fopen(filename, "wb");
+	if (!f)
+	{
+		eve_printf_debug("Unable to create trace file %s\n", filename);
+		return false;
+	}
+	fwrite("EVTR", 1, 4, f);
+	writeValue(f, EVE_HAL_TRACE_VERSION, 4);
+	phost->TraceFile = f;
+	phost->TraceStart = EVE_millis();
+	phost->TraceDataIndex = 0;
+	return true;
+}
+
+/**
+ * @brief Stop recording
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_HalTrace_stop(EVE_HalContext *phost)
+{
+	FILE *f = (FILE *)phost->TraceFile;
+	if (!f)
+		return;
+	flushData(phost);
+	fclose(f);
+	phost->TraceFile = NULL;
+}
+
+/**
+ * @brief Write the recording through to the file at a frame boundary
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_HalTrace_frame(EVE_HalContext *phost)
+{
+	FILE *f = (FILE *)phost->TraceFile;
+	if (!f)
+		return;
+	flushData(phost);
+	fflush(f);
+}
+///@}
+
+/*************
+** TRANSFER **
+*************/
+
+/** @name Transfer */
+///@{
+
+void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
+{
+	FILE *f = (FILE *)phost->TraceFile;
+	if (f)
+	{
+		fputc(EVE_HAL_TRACE_START, f);
+		fputc(rw, f);
+		writeValue(f, addr, 4);
+		writeValue(f, EVE_millis() - phost->TraceStart, 4);
+	}
+	EVE_HalImpl_startTransfer(phost, rw, addr);
+}
+
+void EVE_Hal_endTransfer(EVE_HalContext *phost)
+{
+	EVE_HalImpl_endTransfer(phost);
+	if (phost->TraceFile)
+	{
+		flushData(phost);
+		fputc(EVE_HAL_TRACE_END, (FILE *)phost->TraceFile);
+	}
+}
+
+uint8_t EVE_Hal_transfer8(EVE_HalContext *phost, uint8_t value)
+{
+	uint8_t res = EVE_HalImpl_transfer8(phost, value);
+	traceValue(phost, phost->Status == EVE_STATUS_READING ? res : value, 1);
+	return res;
+}
+
+uint16_t EVE_Hal_transfer16(EVE_HalContext *phost, uint16_t value)
+{
+	uint16_t res = EVE_HalImpl_transfer16(phost, value);
+	traceValue(phost, phost->Status == EVE_STATUS_READING ? res : value, 2);
+	return res;
+}
+
+uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value)
+{
+	uint32_t res = EVE_HalImpl_transfer32(phost, value);
+	traceValue(phost, phost->Status == EVE_STATUS_READING ? res : value, 4);
+	return res;
+}
+
+void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *buffer, uint32_t size)
+{
+	EVE_HalImpl_transferMem(phost, result, buffer, size);
+	traceData(phost, result ? result : buffer, size);
+}
+
+void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size)
+{
+	EVE_HalImpl_transferProgMem(phost, result, buffer, size);
+	if (result)
+	{
+		traceData(phost, result, size);
+	}
+	else if (phost->TraceFile)
+	{
+		uint32_t i;
+		for (i = 0; i < size; ++i)
+		{
+			uint8_t c = buffer[i];
+			traceData(phost, &c, 1);
+		}
+	}
+}
+
+uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask)
+{
+	uint32_t transferred = EVE_HalImpl_transferString(phost, str, index, size, padMask);
+	if (phost->TraceFile)
+	{
+		/* Reconstruct the null terminated and padded string as sent */
+		bool terminated = false;
+		uint32_t i;
+		for (i = 0; i < transferred; ++i)
+		{
+			uint8_t c = 0;
+			if (!terminated && i < size)
+			{
+				c = str[index + i];
+				terminated = !c;
+			}
+			traceData(phost, &c, 1);
+		}
+	}
+	return transferred;
+}
+
+void EVE_Hal_flush(EVE_HalContext *phost)
+{
+	EVE_HalImpl_flush(phost);
+	if (phost->TraceFile)
+		fputc(EVE_HAL_TRACE_FLUSH, (FILE *)phost->TraceFile);
+}
+///@}
+
+/*************
+** REPLAYER **
+*************/
+
+/** @name Replayer */
+///@{
+
+/**
+ * @brief Read a little endian value from the trace file
+ *
+ * @param f Trace file
+ * @param value Receives the value
+ * @param size Number of bytes to read
+ * @return true True if ok
+ * @return false False at end of file
+ */
+static bool readValue(FILE *f, uint32_t *value, int size)
+{
+	int i;
+	*value = 0;
+	for (i = 0; i < size; ++i)
+	{
+		int c = fgetc(f);
+		if (c == EOF)
+			return false;
+		*value |= (uint32_t)c << (i * 8);
+	}
+	return true;
+}
+
+/**
+ * @brief Replay a trace file through the active backend
+ *
+ * @param phost Pointer to Hal context
+ * @param filename Trace file to replay
+ * @param stats Receives the replay totals, may be NULL
+ * @return true True if ok
+ * @return false False if the file is not a valid trace
+ */
+bool EVE_HalTrace_replay(EVE_HalContext *phost, const char *filename, EVE_HalTraceStats *stats)
+{
+	EVE_HalTraceStats s = { 0 };
+	uint8_t data[EVE_HAL_TRACE_BUFFER];
+	uint8_t result[EVE_HAL_TRACE_BUFFER];
+	char magic[4];
+	uint32_t version;
+	uint32_t start;
+	bool ok = true;
+	int op;
+	FILE *f;
+
+	f = fopen(filename, "rb");
+	if (!f)
+	{
+		eve_printf_debug("Unable to open trace file %s\n", filename);
+		return false;
+	}
+	if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "EVTR", 4)
+	    || !readValue(f, &version, 4) || version != EVE_HAL_TRACE_VERSION)
+	{
+		eve_printf_debug("Not a valid trace file %s\n", filename);
+		fclose(f);
+		return false;
+	}
+
+	start = EVE_millis();
+	while (ok && (op = fgetc(f)) != EOF)
+	{
+		switch (op)
+		{
+		case EVE_HAL_TRACE_START:
+		{
+			int rw = fgetc(f);
+			uint32_t addr;
+			uint32_t time;
+			ok = rw != EOF && readValue(f, &addr, 4) && readValue(f, &time, 4);
+			if (ok)
+			{
+				EVE_Hal_startTransfer(phost, (EVE_TRANSFER_T)rw, addr);
+				++s.Transfers;
+			}
+			break;
+		}
+		case EVE_HAL_TRACE_DATA:
+		{
+			uint32_t size;
+			ok = readValue(f, &size, 2) && size <= EVE_HAL_TRACE_BUFFER
+			    && fread(data, 1, size, f) == size;
+			if (!ok)
+				break;
+			if (phost->Status == EVE_STATUS_READING)
+			{
+				uint32_t i;
+				EVE_Hal_transferMem(phost, result, NULL, size);
+				for (i = 0; i < size; ++i)
+					s.ReadMismatches += (result[i] != data[i]);
+				s.BytesRead += size;
+			}
+			else
+			{
+				EVE_Hal_transferMem(phost, NULL, data, size);
+				s.BytesWritten += size;
+			}
+			break;
+		}
+		case EVE_HAL_TRACE_END:
+			EVE_Hal_endTransfer(phost);
+			break;
+		case EVE_HAL_TRACE_FLUSH:
+			EVE_Hal_flush(phost);
+			break;
+		default:
+			ok = false;
+			break;
+		}
+	}
+	s.Millis = EVE_millis() - start;
+
+	if (!ok && feof(f))
+	{
+		/* Recording was interrupted, everything before the cut off record is valid */
+		eve_printf_debug("Trace file %s ends in a truncated record\n", filename);
+		ok = true;
+	}
+	else if (!ok)
+	{
+		eve_printf_debug("Trace file %s is corrupt\n", filename);
+	}
+	fclose(f);
+
+	/* Close a transfer left open by the end of the trace */
+	if (phost->Status == EVE_STATUS_READING || phost->Status == EVE_STATUS_WRITING)
+		EVE_Hal_endTransfer(phost);
+	if (stats)
+		*stats = s;
+	return ok;
+}
+///@}
+
+#endif
+
+/* end of file */
@@ -0,0 +1,90 @@
+/**
+ * @file EVE_HalTrace.h
+ * @brief Transport trace recorder and replayer
+ *
+ * Records every transfer between the host and the EVE device to a compact
+ * binary file, and replays such a file through the active backend.
+ * Enable with EVE_HAL_TRACE in EVE_Config.h. Requires a platform with stdio.
+ *
+ * Trace file format, all values little endian:
+ * - Header: "EVTR", uint32_t version
+ * - EVE_HAL_TRACE_START: uint8_t rw, uint32_t addr, uint32_t milliseconds since recording started
+ * - EVE_HAL_TRACE_DATA: uint16_t size, size bytes written, or read from the device
+ * - EVE_HAL_TRACE_END: no payload
+ * - EVE_HAL_TRACE_FLUSH: no payload
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EVE_HAL_TRACE__H
+#define EVE_HAL_TRACE__H
+#include "EVE_HalDefs.h"
+
+#if EVE_HAL_TRACE
+
+#define EVE_HAL_TRACE_VERSION 1
+
+/** Record types in a trace file */
+typedef enum EVE_HAL_TRACE_T
+{
+	EVE_HAL_TRACE_START = 1, /**< 1 */
+	EVE_HAL_TRACE_DATA,
+	EVE_HAL_TRACE_END,
+	EVE_HAL_TRACE_FLUSH,
+} EVE_HAL_TRACE_T;
+
+/** Totals of a replayed trace */
+typedef struct EVE_HalTraceStats
+{
+	uint32_t Transfers; /**< Number of transfers started */
+	uint32_t BytesWritten; /**< Payload bytes written to the device */
+	uint32_t BytesRead; /**< Payload bytes read from the device */
+	uint32_t ReadMismatches; /**< Bytes read which differ from the recorded value */
+	uint32_t Millis; /**< Time taken by the replay, in milliseconds */
+} EVE_HalTraceStats;
+
+/** Start recording all transfers to the specified file.
+Any trace that is already being recorded is stopped first */
+bool EVE_HalTrace_start(EVE_HalContext *phost, const char *filename);
+
+/** Stop recording */
+void EVE_HalTrace_stop(EVE_HalContext *phost);
+
+/** Write the recording through to the file.
+Called at every CMD_SWAP, so an interrupted recording still holds all earlier frames */
+void EVE_HalTrace_frame(EVE_HalContext *phost);
+
+/** Replay a trace file through the active backend, as fast as possible.
+A record cut off by the end of the file ends the replay without error.
+Returns false if the file cannot be read or is not a valid trace */
+bool EVE_HalTrace_replay(EVE_HalContext *phost, const char *filename, EVE_HalTraceStats *stats);
+
+#endif
+
+#endif /* #ifndef EVE_HAL_TRACE__H */
+
+/* end of file */
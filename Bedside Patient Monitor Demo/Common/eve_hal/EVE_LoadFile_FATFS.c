@@ -236,8 +236,7 @@ bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t address, const cha
 	}
 	if (fResult == FR_OK)
 	{
-		EVE_Cmd_wr32(phost, CMD_INFLATE);
-		EVE_Cmd_wr32(phost, address);
+		EVE_CoCmd_inflate(phost, address);
 		filesize = f_size(&InfSrc);
 		while (filesize > 0)
 		{
@@ -302,9 +301,7 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 	}
 	if (fResult == FR_OK)
 	{
-		EVE_Cmd_wr32(phost, CMD_LOADIMAGE);
-		EVE_Cmd_wr32(phost, address);
-		EVE_Cmd_wr32(phost, OPT_NODL);
+		EVE_CoCmd_loadImage(phost, address, OPT_NODL);
 		filesize = f_size(&InfSrc);
 		while (filesize > 0)
 		{
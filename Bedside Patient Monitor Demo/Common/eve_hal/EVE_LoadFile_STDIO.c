@@ -35,6 +35,54 @@
 
 #include <stdio.h>
 
+#if EVE_LOADFILE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Map an opened file into memory for sequential reading
+ *
+ * @param afile Opened file
+ * @param size Size of the file
+ * @return const uint8_t* Mapping, or NULL to fall back to reading the file
+ */
+static const uint8_t *mapFile(FILE *afile, uint32_t size)
+{
+	struct stat st;
+	void *map;
+	int fd = fileno(afile);
+	if (!size || fd < 0 || fstat(fd, &st) || (uint64_t)st.st_size != size)
+		return NULL;
+	map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return NULL;
+#ifdef POSIX_MADV_SEQUENTIAL
+	posix_madvise(map, size, POSIX_MADV_SEQUENTIAL); /* Read ahead aggressively, drop pages behind */
+#endif
+	return (const uint8_t *)map;
+}
+
+/**
+ * @brief Write a mapped file into the coprocessor FIFO, the last word padded with zeroes
+ *
+ * @param phost Pointer to Hal context
+ * @param map Mapping
+ * @param size Size of the file
+ * @return false in case a coprocessor fault occurred
+ */
+static bool cmdWrMap(EVE_HalContext *phost, const uint8_t *map, uint32_t size)
+{
+	uint32_t aligned = size & ~3U;
+	uint32_t tail = 0;
+	if (aligned && !EVE_Cmd_wrMem(phost, map, aligned))
+		return false;
+	if (size == aligned)
+		return true;
+	memcpy(&tail, &map[aligned], size - aligned);
+	return EVE_Cmd_wrMem(phost, (uint8_t *)&tail, 4);
+}
+#endif
+
 /**
  * @brief Mount the SDcard
  *
@@ -44,13 +92,13 @@
  */
 bool EVE_Util_loadSdCard(EVE_HalContext *phost)
 {
-	/* no-op */
+	(void)phost; /* no-op */
 	return true;
 }
 
 bool EVE_Util_sdCardReady(EVE_HalContext *phost)
 {
-	/* no-op */
+	(void)phost; /* no-op */
 	return true;
 }
 
@@ -74,6 +122,9 @@ bool EVE_Util_loadRawFile(EVE_HalContext *phost, uint32_t address, const char *f
 	uint8_t pbuff[8192];
 	uint16_t blocklen;
 	uint32_t addr = address;
+#if EVE_LOADFILE_MMAP
+	const uint8_t *map;
+#endif
 #ifdef _WIN32
 	errno_t err = 0;
 #endif
@@ -100,6 +151,16 @@ bool EVE_Util_loadRawFile(EVE_HalContext *phost, uint32_t address, const char *f
 	fseek(afile, 0, SEEK_END);
 	ftsize = ftell(afile);
 	fseek(afile, 0, SEEK_SET);
+#if EVE_LOADFILE_MMAP
+	map = mapFile(afile, ftsize);
+	if (map)
+	{
+		/* Single transfer straight from the page cache */
+		EVE_Hal_wrMem(phost, addr, map, ftsize);
+		munmap((void *)map, ftsize);
+		ftsize = 0;
+	}
+#endif
 	while (ftsize > 0)
 	{
 		blocklen = ftsize > 8192 ? 8192 : (uint16_t)ftsize;
@@ -146,6 +207,9 @@ bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t address, const cha
 	uint32_t ftsize = 0;
 	uint8_t pbuff[8192];
 	uint16_t blocklen;
+#if EVE_LOADFILE_MMAP
+	const uint8_t *map;
+#endif
 #ifdef _WIN32
 	errno_t err = 0;
 #endif
@@ -173,11 +237,25 @@ bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t address, const cha
 			eve_printf_debug("Unable to open: %s\n", filename);
 		return false;
 	}
-	EVE_Cmd_wr32(phost, CMD_INFLATE);
-	EVE_Cmd_wr32(phost, address);
+	EVE_CoCmd_inflate(phost, address);
 	fseek(afile, 0, SEEK_END);
 	ftsize = ftell(afile);
 	fseek(afile, 0, SEEK_SET);
+#if EVE_LOADFILE_MMAP
+	map = mapFile(afile, ftsize);
+	if (map)
+	{
+		/* Write straight from the page cache, without the copy into pbuff */
+		bool written = cmdWrMap(phost, map, ftsize);
+		munmap((void *)map, ftsize);
+		if (!written)
+		{
+			fclose(afile);
+			return false;
+		}
+		ftsize = 0;
+	}
+#endif
 	while (ftsize > 0)
 	{
 		blocklen = ftsize > 8192 ? 8192 : (uint16_t)ftsize;
@@ -229,6 +307,9 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 	uint32_t ftsize = 0;
 	uint8_t pbuff[8192];
 	uint16_t blocklen;
+#if EVE_LOADFILE_MMAP
+	const uint8_t *map;
+#endif
 #ifdef _WIN32
 	errno_t err = 0;
 #endif
@@ -256,9 +337,7 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 			eve_printf_debug("Unable to open: %s\n", filename);
 		return 0;
 	}
-	EVE_Cmd_wr32(phost, CMD_LOADIMAGE);
-	EVE_Cmd_wr32(phost, address);
-	EVE_Cmd_wr32(phost, OPT_NODL);
+	EVE_CoCmd_loadImage(phost, address, OPT_NODL);
 	// TODO: Let it write into the scratch display list handle,
 	//  and read it out and write into the bitmapInfo the proper
 	//  values to use. Replace compressed bool with uint8 enum to
@@ -266,6 +345,21 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 	fseek(afile, 0, SEEK_END);
 	ftsize = ftell(afile);
 	fseek(afile, 0, SEEK_SET);
+#if EVE_LOADFILE_MMAP
+	map = mapFile(afile, ftsize);
+	if (map)
+	{
+		/* Write straight from the page cache, without the copy into pbuff */
+		bool written = cmdWrMap(phost, map, ftsize);
+		munmap((void *)map, ftsize);
+		if (!written)
+		{
+			fclose(afile);
+			return false;
+		}
+		ftsize = 0;
+	}
+#endif
 	while (ftsize > 0)
 	{
 		blocklen = ftsize > 8192 ? 8192 : (uint16_t)ftsize;
@@ -384,6 +478,7 @@ size_t EVE_Util_readFile(EVE_HalContext *phost, uint8_t *buffer, size_t size, co
 #ifdef _WIN32
 	errno_t err = 0;
 #endif
+	(void)phost;
 
 #ifdef _WIN32
 	// afile = filename ? fopen(filename, "rb") : _wfopen(filenameW, L"rb");
@@ -433,16 +528,9 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 {
 	FILE *afile;
 	uint32_t remaining = 0;
-	uint32_t blockSize = ((phost->MediaFifoSize >> 3) << 2) - 4;
-#ifdef _WIN32
-#pragma warning(push)
-#pragma warning(disable : 6255)
-	uint8_t *pbuff = (uint8_t *)_alloca(blockSize);
-#pragma warning(pop)
-#else
-	uint8_t *pbuff = (uint8_t *)alloca(blockSize);
-#endif
-	uint16_t blocklen;
+	uint32_t streamed = 0;
+	long position;
+	EVE_MediaSource source;
 #ifdef _WIN32
 	errno_t err = 0;
 #endif
@@ -482,63 +570,40 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 	{
 		fseek(afile, 0, SEEK_END);
 		remaining = ftell(afile);
-		fseek(afile, transfered ? *transfered : 0, SEEK_SET);
+		position = transfered ? (long)min(*transfered, remaining) : 0;
+		remaining -= position;
+		fseek(afile, position, SEEK_SET);
 		if (transfered)
 			phost->LoadFileHandle = afile;
 	}
 	else
 	{
 		remaining = (uint32_t)phost->LoadFileRemaining;
+		position = ftell(afile);
 	}
-	while (remaining > 0)
-	{
-		blocklen = (uint16_t)min(blockSize, remaining);
-		blocklen = (uint16_t)fread((void *)pbuff, 1, blocklen, afile); /* Copy the data into pbuff and then transfter it to command buffer */
 
-		if (blocklen == 0)
-		{
-			eve_printf_debug("Read 0 bytes, unexpected end of file, %i bytes remaining", (int)remaining);
-			break;
-		}
+	/* Reads ahead into the next host buffer while the current one is written */
+	EVE_MediaSource_file(&source, afile, remaining);
+	EVE_MediaFifo_stream(phost, &source, transfered ? &streamed : NULL);
 
-		remaining -= blocklen;
-		blocklen += 3;
-		blocklen &= ~3U;
-
-		if (transfered)
-		{
-			uint32_t transferedPart = 0;
-			bool wrRes = EVE_MediaFifo_wrMem(phost, pbuff, blocklen, &transferedPart); /* Copy data continuously into media fifo memory */
-			*transfered += transferedPart;
-			if (transferedPart < blocklen)
-			{
-				long offset = (long)transferedPart - (long)blocklen; /* Negative */
-				fseek(afile, offset, SEEK_CUR); /* Seek back */
-				remaining -= offset; /* Increments remaining (double negative) */
-				break; /* Early exit, processing done */
-			}
-			if (!wrRes)
-				break;
-		}
-		else
-		{
-			if (!EVE_MediaFifo_wrMem(phost, pbuff, blocklen, NULL)) /* Copy data continuously into media fifo memory */
-				break; /* Coprocessor fault */
-		}
-	}
 	if (!transfered)
 	{
 		fclose(afile); /* Close the opened file */
+		return EVE_MediaFifo_waitFlush(phost, false);
 	}
-	else if (remaining)
+
+	*transfered += streamed;
+	remaining -= streamed;
+	if (remaining)
 	{
+		fseek(afile, position + (long)streamed, SEEK_SET); /* Seek back to the first byte not accepted, the source may have read ahead */
 		phost->LoadFileRemaining = remaining; /* Save remaining */
 	}
 	else
 	{
 		EVE_Util_closeFile(phost);
 	}
-	return transfered ? EVE_Cmd_waitFlush(phost) : EVE_MediaFifo_waitFlush(phost, false);
+	return EVE_Cmd_waitFlush(phost);
 }
 
 void EVE_Util_closeFile(EVE_HalContext *phost)
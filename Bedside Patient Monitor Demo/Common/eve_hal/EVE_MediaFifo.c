@@ -34,6 +34,10 @@
 
 #ifdef EVE_SUPPORT_MEDIAFIFO
 
+#if EVE_MEDIA_STREAM_THREAD
+#include <pthread.h>
+#endif
+
 /**
  * @brief Set the media FIFO.
  *
@@ -123,8 +127,8 @@ uint32_t EVE_MediaFifo_space(EVE_HalContext *phost)
 	if (!phost->MediaFifoSize)
 		return 0;
 
-	int32_t rp = EVE_Hal_rd32(phost, REG_MEDIAFIFO_READ);
-	int32_t wp = EVE_Hal_rd32(phost, REG_MEDIAFIFO_WRITE);
+	uint32_t rp = EVE_Hal_rd32(phost, REG_MEDIAFIFO_READ);
+	uint32_t wp = EVE_Hal_rd32(phost, REG_MEDIAFIFO_WRITE);
 #if 1
 	return rp > wp
 	    ? (rp - wp - 4)
@@ -378,6 +382,7 @@ bool EVE_MediaFifo_waitFlush(EVE_HalContext *phost, bool orCmdFlush)
 uint32_t EVE_MediaFifo_waitSpace(EVE_HalContext *phost, uint32_t size, bool orCmdFlush)
 {
 	uint32_t space;
+	uint32_t start;
 
 	if (!EVE_Hal_supportMediaFifo(phost))
 	{
@@ -406,24 +411,364 @@ uint32_t EVE_MediaFifo_waitSpace(EVE_HalContext *phost, uint32_t size, bool orCm
 		return 0;
 #endif
 
+	start = EVE_millis();
 	do
 	{
 		space = EVE_MediaFifo_space(phost);
 		if (!handleWait(phost, (uint16_t)space))
-			return 0;
+		{
+			space = 0;
+			break;
+		}
 		phost->CmdWaiting = false;
 		uint32_t cmdSpace = EVE_Cmd_waitSpace(phost, 0);
-		if (!cmdSpace)
-			return 0; /* Check for coprocessor error */
-		if (orCmdFlush && cmdSpace == (EVE_CMD_FIFO_SIZE - 4))
-			return 0; /* Processed */
+		if (!cmdSpace || (orCmdFlush && cmdSpace == (EVE_CMD_FIFO_SIZE - 4)))
+		{
+			space = 0; /* Coprocessor error, or processed */
+			break;
+		}
 		phost->CmdWaiting = true;
 	} while (space < size);
+	phost->Stats.WaitMediaFifoMillis += EVE_millis() - start;
 
 	phost->CmdWaiting = false;
 	return space;
 }
 
+/**************************
+** MEDIAFIFO STREAMING **
+***************************/
+
+/** Host buffers of EVE_MediaFifo_stream.
+Blocks are read into the buffers in order, and written to the media FIFO in the same order.
+Block n is in buffer n % EVE_MEDIA_STREAM_BUFFERS */
+typedef struct EVE_MediaStream
+{
+	EVE_MediaSource *Source;
+	uint32_t BlockSize;
+	uint32_t Filled; /* Number of blocks read */
+	uint32_t Consumed; /* Number of blocks written to the media FIFO */
+	bool Pending; /* StartRead was called for block Filled */
+#if EVE_MEDIA_STREAM_THREAD
+	bool Threaded;
+	bool Stop;
+	pthread_t Thread;
+	pthread_mutex_t Mutex;
+	pthread_cond_t Cond;
+#endif
+	uint32_t Length[EVE_MEDIA_STREAM_BUFFERS];
+	uint32_t Buffer[EVE_MEDIA_STREAM_BUFFERS][EVE_MEDIA_STREAM_BUFFER_SIZE >> 2];
+} EVE_MediaStream;
+
+#if EVE_MEDIA_STREAM_THREAD
+
+/**
+ * @brief Reader thread, fills the free buffers ahead of the writer
+ *
+ * @param arg Stream
+ * @return NULL
+ */
+static void *streamThread(void *arg)
+{
+	EVE_MediaStream *stream = (EVE_MediaStream *)arg;
+	uint32_t filled = 0;
+	uint32_t len;
+	uint32_t idx;
+
+	do
+	{
+		pthread_mutex_lock(&stream->Mutex);
+		while (!stream->Stop && (filled - stream->Consumed) >= EVE_MEDIA_STREAM_BUFFERS)
+			pthread_cond_wait(&stream->Cond, &stream->Mutex);
+		if (stream->Stop)
+		{
+			pthread_mutex_unlock(&stream->Mutex);
+			break;
+		}
+		pthread_mutex_unlock(&stream->Mutex);
+
+		/* The writer does not touch this buffer until Filled is incremented */
+		idx = filled % EVE_MEDIA_STREAM_BUFFERS;
+		len = stream->Source->Read(stream->Source, (uint8_t *)stream->Buffer[idx], stream->BlockSize);
+
+		pthread_mutex_lock(&stream->Mutex);
+		stream->Length[idx] = len;
+		stream->Filled = ++filled;
+		pthread_cond_signal(&stream->Cond);
+		pthread_mutex_unlock(&stream->Mutex);
+	} while (len);
+
+	return NULL;
+}
+
+#endif
+
+/**
+ * @brief Wait for the next block to be read
+ *
+ * @param stream Stream
+ * @return uint32_t Length of the block, 0 at the end of the source
+ */
+static uint32_t streamAcquire(EVE_MediaStream *stream)
+{
+	uint32_t idx = stream->Consumed % EVE_MEDIA_STREAM_BUFFERS;
+	EVE_MediaSource *source = stream->Source;
+
+#if EVE_MEDIA_STREAM_THREAD
+	if (stream->Threaded)
+	{
+		uint32_t len;
+		pthread_mutex_lock(&stream->Mutex);
+		while (stream->Filled == stream->Consumed)
+			pthread_cond_wait(&stream->Cond, &stream->Mutex);
+		len = stream->Length[idx];
+		pthread_mutex_unlock(&stream->Mutex);
+		return len;
+	}
+#endif
+
+	/* Completes the read started by streamPrefetch, if any */
+	stream->Length[idx] = source->Read(source, (uint8_t *)stream->Buffer[idx], stream->BlockSize);
+	stream->Pending = false;
+	stream->Filled = stream->Consumed + 1;
+	return stream->Length[idx];
+}
+
+/**
+ * @brief Start reading the block after the acquired one, when the source can read in the background
+ *
+ * @param stream Stream
+ */
+static void streamPrefetch(EVE_MediaStream *stream)
+{
+	uint32_t idx = stream->Filled % EVE_MEDIA_STREAM_BUFFERS;
+	EVE_MediaSource *source = stream->Source;
+
+#if EVE_MEDIA_STREAM_THREAD
+	if (stream->Threaded)
+		return;
+#endif
+
+	if (source->StartRead)
+	{
+		source->StartRead(source, (uint8_t *)stream->Buffer[idx], stream->BlockSize);
+		stream->Pending = true;
+	}
+}
+
+/**
+ * @brief Release the acquired block, its buffer may be read into again
+ *
+ * @param stream Stream
+ */
+static void streamRelease(EVE_MediaStream *stream)
+{
+#if EVE_MEDIA_STREAM_THREAD
+	if (stream->Threaded)
+	{
+		pthread_mutex_lock(&stream->Mutex);
+		++stream->Consumed;
+		pthread_cond_signal(&stream->Cond);
+		pthread_mutex_unlock(&stream->Mutex);
+		return;
+	}
+#endif
+
+	++stream->Consumed;
+}
+
+/**
+ * @brief Stream a source into the media FIFO.
+ *
+ * @param phost Pointer to Hal context
+ * @param source Source of the data
+ * @param transfered If set, exit early once the coprocessor function has finished, and add the number of bytes accepted
+ * @returns false in case a coprocessor fault occurred
+ */
+bool EVE_MediaFifo_stream(EVE_HalContext *phost, EVE_MediaSource *source, uint32_t *transfered)
+{
+	EVE_MediaStream stream;
+	uint8_t *buffer;
+	uint32_t len;
+	uint32_t padded;
+	uint32_t transferedPart;
+	bool wrRes;
+
+	if (!EVE_Hal_supportMediaFifo(phost))
+	{
+		eve_assert_ex(false, "EVE_MediaFifo_stream is not available on the current graphics platform\n");
+		return false;
+	}
+
+	if (!phost->MediaFifoSize)
+	{
+		eve_printf_debug("EVE Media FIFO has not been set, cannot stream\n");
+		return false;
+	}
+
+	eve_assert(!(EVE_MEDIA_STREAM_BUFFER_SIZE & 3) && EVE_MEDIA_STREAM_BUFFERS >= 2);
+	stream.Source = source;
+	stream.BlockSize = min(EVE_MEDIA_STREAM_BUFFER_SIZE, ((phost->MediaFifoSize >> 3) << 2) - 4);
+	stream.Filled = 0;
+	stream.Consumed = 0;
+	stream.Pending = false;
+
+#if EVE_MEDIA_STREAM_THREAD
+	stream.Stop = false;
+	stream.Threaded = false;
+	if (source->ReadAhead && !pthread_mutex_init(&stream.Mutex, NULL))
+	{
+		if (!pthread_cond_init(&stream.Cond, NULL))
+		{
+			stream.Threaded = !pthread_create(&stream.Thread, NULL, streamThread, &stream);
+			if (!stream.Threaded)
+				pthread_cond_destroy(&stream.Cond);
+		}
+		if (!stream.Threaded)
+			pthread_mutex_destroy(&stream.Mutex);
+	}
+	if (source->ReadAhead && !stream.Threaded)
+		eve_printf_debug("Media FIFO reader thread not available, reading synchronously\n");
+#endif
+
+	streamPrefetch(&stream);
+	while ((len = streamAcquire(&stream)))
+	{
+		buffer = (uint8_t *)stream.Buffer[stream.Consumed % EVE_MEDIA_STREAM_BUFFERS];
+		padded = (len + 3) & ~3U;
+		if (padded > len)
+			memset(&buffer[len], 0, padded - len);
+
+		/* Read the next block while this one is written */
+		streamPrefetch(&stream);
+
+		if (transfered)
+		{
+			transferedPart = 0;
+			wrRes = EVE_MediaFifo_wrMem(phost, buffer, padded, &transferedPart);
+			*transfered += min(transferedPart, len);
+			if (!wrRes || transferedPart < padded)
+				break; /* Early exit, processing done, or coprocessor fault */
+		}
+		else if (!EVE_MediaFifo_wrMem(phost, buffer, padded, NULL))
+		{
+			break; /* Coprocessor fault */
+		}
+
+		streamRelease(&stream);
+	}
+
+#if EVE_MEDIA_STREAM_THREAD
+	if (stream.Threaded)
+	{
+		pthread_mutex_lock(&stream.Mutex);
+		stream.Stop = true;
+		pthread_cond_signal(&stream.Cond);
+		pthread_mutex_unlock(&stream.Mutex);
+		pthread_join(stream.Thread, NULL);
+		pthread_cond_destroy(&stream.Cond);
+		pthread_mutex_destroy(&stream.Mutex);
+	}
+#endif
+
+	/* Complete the background read before its buffer goes out of scope */
+	if (stream.Pending)
+		source->Read(source, (uint8_t *)stream.Buffer[stream.Filled % EVE_MEDIA_STREAM_BUFFERS], stream.BlockSize);
+
+	return !phost->CmdFault;
+}
+
+static uint32_t memoryRead(EVE_MediaSource *source, uint8_t *buffer, uint32_t size)
+{
+	uint32_t len = min(size, source->Remaining);
+	memcpy(buffer, source->Handle, len);
+	source->Handle = (uint8_t *)source->Handle + len;
+	source->Remaining -= len;
+	return len;
+}
+
+/**
+ * @brief Initialize a source reading size bytes from memory
+ *
+ * @param source Source to initialize
+ * @param data Data
+ * @param size Size of the data
+ */
+void EVE_MediaSource_memory(EVE_MediaSource *source, const void *data, uint32_t size)
+{
+	source->Read = memoryRead;
+	source->StartRead = NULL;
+	source->Handle = (void *)data;
+	source->Remaining = size;
+	source->ReadAhead = false;
+}
+
+#if !defined(FT9XX_PLATFORM) && !defined(RP2040_PLATFORM)
+
+static uint32_t fileRead(EVE_MediaSource *source, uint8_t *buffer, uint32_t size)
+{
+	uint32_t len = (uint32_t)fread(buffer, 1, min(size, source->Remaining), (FILE *)source->Handle);
+	if (!len && source->Remaining)
+	{
+		eve_printf_debug("Read 0 bytes, unexpected end of file, %i bytes remaining\n", (int)source->Remaining);
+		source->Remaining = 0;
+	}
+	source->Remaining -= len;
+	return len;
+}
+
+/**
+ * @brief Initialize a source reading size bytes from the current position of a stdio file
+ *
+ * @param source Source to initialize
+ * @param file File, opened for reading in binary mode
+ * @param size Number of bytes to read
+ */
+void EVE_MediaSource_file(EVE_MediaSource *source, FILE *file, uint32_t size)
+{
+	source->Read = fileRead;
+	source->StartRead = NULL;
+	source->Handle = file;
+	source->Remaining = size;
+	source->ReadAhead = true;
+}
+
+#endif
+
+#if EVE_ENABLE_FATFS
+
+static uint32_t fatfsRead(EVE_MediaSource *source, uint8_t *buffer, uint32_t size)
+{
+	UINT len = 0;
+	if (f_read((FIL *)source->Handle, buffer, min(size, source->Remaining), &len) != FR_OK || !len)
+	{
+		if (source->Remaining)
+			eve_printf_debug("Failed to read file, %i bytes remaining\n", (int)source->Remaining);
+		source->Remaining = 0;
+		return 0;
+	}
+	source->Remaining -= len;
+	return len;
+}
+
+/**
+ * @brief Initialize a source reading size bytes from the current position of a FatFs file
+ *
+ * @param source Source to initialize
+ * @param file File, opened for reading
+ * @param size Number of bytes to read
+ */
+void EVE_MediaSource_fatfs(EVE_MediaSource *source, FIL *file, uint32_t size)
+{
+	source->Read = fatfsRead;
+	source->StartRead = NULL;
+	source->Handle = file;
+	source->Remaining = size;
+	source->ReadAhead = true;
+}
+
+#endif
+
 #endif
 
 /* end of file */
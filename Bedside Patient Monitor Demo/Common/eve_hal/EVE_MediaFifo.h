@@ -77,6 +77,57 @@ bool EVE_MediaFifo_waitFlush(EVE_HalContext *phost, bool orCmdFlush);
 Returns 0 in case a coprocessor fault occurred, or in case the coprocessor is done processing */
 uint32_t EVE_MediaFifo_waitSpace(EVE_HalContext *phost, uint32_t size, bool orCmdFlush);
 
+/************************
+** MEDIAFIFO STREAMING **
+*************************/
+
+/** Source of data for EVE_MediaFifo_stream */
+typedef struct EVE_MediaSource EVE_MediaSource;
+struct EVE_MediaSource
+{
+	/** Read up to size bytes into buffer.
+	Returns the number of bytes read, 0 at the end of the data or on error.
+	Called on the reader thread when EVE_MEDIA_STREAM_THREAD is enabled */
+	uint32_t (*Read)(EVE_MediaSource *source, uint8_t *buffer, uint32_t size);
+
+	/** Optional. Start reading up to size bytes into buffer without waiting for
+	the data, for sources which can transfer in the background. Read is then
+	called with the same buffer and size to wait for the data. The sources
+	provided here do not implement it. Not used when reading ahead on the
+	reader thread */
+	void (*StartRead)(EVE_MediaSource *source, uint8_t *buffer, uint32_t size);
+
+	void *Handle; /**< Data pointer or file handle */
+	uint32_t Remaining; /**< Number of bytes left to read */
+	bool ReadAhead; /**< Read may wait for storage, read ahead on the reader thread when available */
+};
+
+/** Stream a source into the media FIFO.
+Blocks are read into host buffers and written to the media FIFO in order, see
+EVE_MEDIA_STREAM_BUFFERS. Reading only overlaps writing on the reader thread,
+see EVE_MEDIA_STREAM_THREAD, or for sources implementing StartRead.
+Returns false in case a coprocessor fault occurred.
+If the transfered pointer is set, the stream may exit early
+if the coprocessor function has finished, and the number of
+source bytes accepted by the media FIFO is added to transfered.
+The source may have been read further than that */
+bool EVE_MediaFifo_stream(EVE_HalContext *phost, EVE_MediaSource *source, uint32_t *transfered);
+
+/** Initialize a source reading size bytes from memory */
+void EVE_MediaSource_memory(EVE_MediaSource *source, const void *data, uint32_t size);
+
+#if !defined(FT9XX_PLATFORM) && !defined(RP2040_PLATFORM)
+#include <stdio.h>
+
+/** Initialize a source reading size bytes from the current position of a stdio file */
+void EVE_MediaSource_file(EVE_MediaSource *source, FILE *file, uint32_t size);
+#endif
+
+#if EVE_ENABLE_FATFS
+/** Initialize a source reading size bytes from the current position of a FatFs file */
+void EVE_MediaSource_fatfs(EVE_MediaSource *source, FIL *file, uint32_t size);
+#endif
+
 #else
 
 #define EVE_MediaFifo_set(phost, address, size) (false)
@@ -86,6 +137,7 @@ uint32_t EVE_MediaFifo_waitSpace(EVE_HalContext *phost, uint32_t size, bool orCm
 #define EVE_MediaFifo_wrMem(phost, buffer, size, transfered) (false)
 #define EVE_MediaFifo_waitFlush(phost) (false)
 #define EVE_MediaFifo_waitSpace(phost, size) (false)
+#define EVE_MediaFifo_stream(phost, source, transfered) (false)
 
 #endif
 
@@ -65,12 +65,15 @@ extern "C" {
 #include "EVE_MediaFifo.h"
 #include "EVE_CoCmd.h"
 #include "EVE_CoDl.h"
+#include "EVE_Seg.h"
+#include "EVE_RamG.h"
 #include "EVE_GpuDefs.h"
 #if defined(ENABLE_ILI9488_HVGA_PORTRAIT) || defined(ENABLE_KD2401_HVGA_PORTRAIT)
 #include "EVE_ILI9488.h"
 #endif
 #include "EVE_Util.h"
 #include "EVE_LoadFile.h"
+#include "EVE_HalTrace.h"
 
 #define eve_noop() \
 	do             \
@@ -0,0 +1,258 @@
+/**
+ * @file EVE_RamG.c
+ * @brief RAM_G allocator
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_RamG.h"
+#include "EVE_Platform.h"
+
+#if EVE_RAMG_BLOCKS
+
+/**
+ * @brief Create the single free block covering the heap, on first use
+ *
+ * @param phost Pointer to Hal context
+ */
+static void initHeap(EVE_HalContext *phost)
+{
+	if (phost->RamGCount)
+		return;
+	phost->RamG[0].Addr = RAM_G;
+	phost->RamG[0].Size = EVE_RAMG_END - RAM_G;
+	phost->RamG[0].Used = false;
+	phost->RamGCount = 1;
+}
+
+/**
+ * @brief Insert a block into the table
+ *
+ * @param phost Pointer to Hal context
+ * @param idx Index of the new block
+ * @param addr Address
+ * @param size Size
+ * @param used Allocated or free
+ */
+static void insertBlock(EVE_HalContext *phost, uint8_t idx, uint32_t addr, uint32_t size, bool used)
+{
+	eve_assert(phost->RamGCount < EVE_RAMG_BLOCKS);
+	memmove(&phost->RamG[idx + 1], &phost->RamG[idx], (phost->RamGCount - idx) * sizeof(EVE_HalRamGBlock));
+	phost->RamG[idx].Addr = addr;
+	phost->RamG[idx].Size = size;
+	phost->RamG[idx].Used = used;
+	++phost->RamGCount;
+}
+
+/**
+ * @brief Remove a block from the table
+ *
+ * @param phost Pointer to Hal context
+ * @param idx Index of the block
+ */
+static void removeBlock(EVE_HalContext *phost, uint8_t idx)
+{
+	--phost->RamGCount;
+	memmove(&phost->RamG[idx], &phost->RamG[idx + 1], (phost->RamGCount - idx) * sizeof(EVE_HalRamGBlock));
+}
+
+/**
+ * @brief Allocate RAM_G
+ *
+ * @param phost Pointer to Hal context
+ * @param size Number of bytes, rounded up to a multiple of 4
+ * @param align Alignment class, a power of two, at least 4
+ * @return Address of the allocation, EVE_RAMG_NULL if it does not fit
+ */
+uint32_t EVE_RamG_alloc(EVE_HalContext *phost, uint32_t size, uint32_t align)
+{
+	EVE_HalRamGBlock *block;
+	uint32_t addr;
+	uint32_t pad;
+	uint32_t rest;
+	uint8_t best = EVE_RAMG_BLOCKS;
+	uint8_t i;
+
+	eve_assert(align && !(align & (align - 1)));
+	align = max(align, EVE_RAMG_ALIGN_DEFAULT);
+	size = (size + 3) & ~3UL;
+	if (!size)
+		return EVE_RAMG_NULL;
+	initHeap(phost);
+
+	/* Best fit, the smallest free block which holds the aligned request */
+	for (i = 0; i < phost->RamGCount; ++i)
+	{
+		block = &phost->RamG[i];
+		if (block->Used)
+			continue;
+		pad = ((block->Addr + align - 1) & ~(align - 1)) - block->Addr;
+		if (pad + size <= block->Size && (best == EVE_RAMG_BLOCKS || block->Size < phost->RamG[best].Size))
+			best = i;
+	}
+	if (best == EVE_RAMG_BLOCKS)
+	{
+		eve_printf_debug("RAM_G allocation of %u bytes failed\n", (unsigned int)size);
+		return EVE_RAMG_NULL;
+	}
+
+	block = &phost->RamG[best];
+	addr = (block->Addr + align - 1) & ~(align - 1);
+	pad = addr - block->Addr;
+	rest = block->Size - pad - size;
+
+	/* Split off the padding and the rest as free blocks, while there is room in the table.
+	Otherwise they stay part of the allocation, and are freed with it */
+	if (pad && phost->RamGCount < EVE_RAMG_BLOCKS)
+	{
+		insertBlock(phost, best, block->Addr, pad, false);
+		++best;
+		block = &phost->RamG[best];
+		block->Addr = addr;
+		block->Size -= pad;
+	}
+	if (rest && phost->RamGCount < EVE_RAMG_BLOCKS)
+	{
+		insertBlock(phost, best + 1, addr + size, rest, false);
+		block = &phost->RamG[best];
+		block->Size -= rest;
+	}
+	block->Used = true;
+
+	phost->RamGHighWater = max(phost->RamGHighWater, block->Addr + block->Size - RAM_G);
+	return addr;
+}
+
+/**
+ * @brief Free RAM_G allocated with EVE_RamG_alloc
+ *
+ * @param phost Pointer to Hal context
+ * @param addr Address returned by EVE_RamG_alloc, or EVE_RAMG_NULL
+ */
+void EVE_RamG_free(EVE_HalContext *phost, uint32_t addr)
+{
+	EVE_HalRamGBlock *block;
+	uint8_t i;
+
+	if (addr == EVE_RAMG_NULL)
+		return;
+
+	/* The block may start before the address, when its padding was not split off */
+	for (i = 0; i < phost->RamGCount; ++i)
+	{
+		block = &phost->RamG[i];
+		if (block->Used && addr >= block->Addr && addr < block->Addr + block->Size)
+			break;
+	}
+	if (i == phost->RamGCount)
+	{
+		eve_printf_debug("RAM_G free of %u, which is not allocated\n", (unsigned int)addr);
+		return;
+	}
+	block->Used = false;
+
+	/* Merge with the free neighbours */
+	if (i + 1 < phost->RamGCount && !phost->RamG[i + 1].Used)
+	{
+		block->Size += phost->RamG[i + 1].Size;
+		removeBlock(phost, i + 1);
+	}
+	if (i > 0 && !phost->RamG[i - 1].Used)
+	{
+		phost->RamG[i - 1].Size += block->Size;
+		removeBlock(phost, i);
+	}
+}
+
+/**
+ * @brief Free all allocations, the high-water mark is kept
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_RamG_reset(EVE_HalContext *phost)
+{
+	phost->RamGCount = 0;
+	initHeap(phost);
+}
+
+/**
+ * @brief Get the usage and fragmentation of the heap
+ *
+ * @param phost Pointer to Hal context
+ * @param stats Receives the snapshot
+ */
+void EVE_RamG_stats(EVE_HalContext *phost, EVE_RamGStats *stats)
+{
+	uint8_t i;
+
+	initHeap(phost);
+	memset(stats, 0, sizeof(EVE_RamGStats));
+	stats->Size = EVE_RAMG_END - RAM_G;
+	stats->HighWater = phost->RamGHighWater;
+	for (i = 0; i < phost->RamGCount; ++i)
+	{
+		const EVE_HalRamGBlock *block = &phost->RamG[i];
+		if (block->Used)
+		{
+			stats->Used += block->Size;
+			++stats->Blocks;
+		}
+		else
+		{
+			stats->LargestFree = max(stats->LargestFree, block->Size & ~3UL);
+			++stats->FreeBlocks;
+		}
+	}
+}
+
+/**
+ * @brief Print all blocks and the fragmentation
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_RamG_dump(EVE_HalContext *phost)
+{
+	EVE_RamGStats stats;
+	uint32_t freeBytes;
+	uint8_t i;
+
+	EVE_RamG_stats(phost, &stats);
+	freeBytes = stats.Size - stats.Used;
+	for (i = 0; i < phost->RamGCount; ++i)
+	{
+		const EVE_HalRamGBlock *block = &phost->RamG[i];
+		eve_printf("RAM_G %08X %8u %s\n", (unsigned int)block->Addr, (unsigned int)block->Size, block->Used ? "used" : "free");
+	}
+	eve_printf("RAM_G %u of %u bytes used in %u blocks, high water %u, %u free blocks, largest free %u, fragmentation %u%%\n",
+	    (unsigned int)stats.Used, (unsigned int)stats.Size, (unsigned int)stats.Blocks, (unsigned int)stats.HighWater,
+	    (unsigned int)stats.FreeBlocks, (unsigned int)stats.LargestFree,
+	    (unsigned int)(freeBytes ? 100 - (uint64_t)stats.LargestFree * 100 / freeBytes : 0));
+}
+
+#endif
+
+/* end of file */
@@ -0,0 +1,92 @@
+/**
+ * @file EVE_RamG.h
+ * @brief RAM_G allocator
+ *
+ * Manages RAM_G from RAM_G up to EVE_RAMG_END, below the areas reserved by
+ * the HAL, so layouts can be released and built again at runtime. Blocks are
+ * kept in an address-ordered table of EVE_RAMG_BLOCKS entries in the Hal
+ * context. Allocation is best fit, freed blocks are merged with their free
+ * neighbours. The address returned is aligned to the requested alignment
+ * class, for example EVE_RAMG_ALIGN_XFONT for CMD_SETFONT2, or
+ * EVE_RAMG_ALIGN_FONTCACHE for CMD_FONTCACHE.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EVE_RAMG__H
+#define EVE_RAMG__H
+#include "EVE_HalDefs.h"
+
+/*******************
+** RAM_G ALLOCATOR **
+*******************/
+
+#define EVE_RAMG_NULL 0xFFFFFFFFUL /**< Returned by EVE_RamG_alloc when the request does not fit */
+
+#define EVE_RAMG_ALIGN_DEFAULT 4 /**< Bitmaps, inflate and load targets */
+#define EVE_RAMG_ALIGN_XFONT 32 /**< Extended font header for CMD_SETFONT2 */
+#define EVE_RAMG_ALIGN_FONTCACHE 64 /**< Font cache for CMD_FONTCACHE */
+
+/** Snapshot of the allocator, see EVE_RamG_stats */
+typedef struct EVE_RamGStats
+{
+	uint32_t Size; /**< Size of the heap */
+	uint32_t Used; /**< Bytes allocated, including the alignment padding */
+	uint32_t LargestFree; /**< Largest free block, the largest request that fits with the default alignment */
+	uint32_t HighWater; /**< Highest end of an allocation, relative to RAM_G */
+	uint16_t Blocks; /**< Number of allocated blocks */
+	uint16_t FreeBlocks; /**< Number of free blocks, more than one means fragmentation */
+} EVE_RamGStats;
+
+#if EVE_RAMG_BLOCKS
+
+/* Block indices are uint8_t, with EVE_RAMG_BLOCKS itself meaning no block */
+#if EVE_RAMG_BLOCKS > 255
+#error "EVE_RAMG_BLOCKS must be at most 255"
+#endif
+
+/** Allocate size bytes of RAM_G, at an address aligned to align, a power of two.
+Returns EVE_RAMG_NULL if there is no free block large enough, or the block table is full */
+uint32_t EVE_RamG_alloc(EVE_HalContext *phost, uint32_t size, uint32_t align);
+
+/** Free an allocation. Does nothing for EVE_RAMG_NULL */
+void EVE_RamG_free(EVE_HalContext *phost, uint32_t addr);
+
+/** Free all allocations */
+void EVE_RamG_reset(EVE_HalContext *phost);
+
+/** Get the usage and fragmentation of the heap */
+void EVE_RamG_stats(EVE_HalContext *phost, EVE_RamGStats *stats);
+
+/** Print all blocks, the usage and the fragmentation */
+void EVE_RamG_dump(EVE_HalContext *phost);
+
+#endif
+
+#endif /* #ifndef EVE_RAMG__H */
+
+/* end of file */
@@ -0,0 +1,206 @@
+/**
+ * @file EVE_Seg.c
+ * @brief Retained display list segments
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_Seg.h"
+#include "EVE_Platform.h"
+
+#if EVE_SEG_COUNT
+
+#define EVE_SEG_ADDR_OF(id) (EVE_SEG_ADDR + ((uint32_t)(id) * EVE_SEG_SIZE))
+
+/**
+ * @brief Keep the display list state left behind by the segment
+ *
+ * @param phost Pointer to Hal context
+ * @param seg Segment
+ */
+static void saveState(EVE_HalContext *phost, EVE_HalSeg *seg)
+{
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+	seg->DlState = EVE_DL_STATE;
+#endif
+#if (EVE_DL_OPTIMIZE)
+	seg->DlPrimitive = phost->DlPrimitive;
+	seg->CoFgColor = phost->CoFgColor;
+	seg->CoBgColor = phost->CoBgColor;
+	seg->CoBitmapTransform = phost->CoBitmapTransform;
+#endif
+}
+
+/**
+ * @brief Apply the display list state left behind by the segment, after drawing it
+ *
+ * @param phost Pointer to Hal context
+ * @param seg Segment
+ */
+static void restoreState(EVE_HalContext *phost, EVE_HalSeg *seg)
+{
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR) || (EVE_SUPPORT_CHIPID < EVE_FT810)
+	EVE_DL_STATE = seg->DlState;
+#endif
+#if (EVE_DL_OPTIMIZE)
+	phost->DlPrimitive = seg->DlPrimitive;
+	phost->CoFgColor = seg->CoFgColor;
+	phost->CoBgColor = seg->CoBgColor;
+	phost->CoBitmapTransform = seg->CoBitmapTransform;
+#endif
+}
+
+/**
+ * @brief Start recording a segment, unless it is already recorded
+ *
+ * @param phost Pointer to Hal context
+ * @param id Segment id, less than EVE_SEG_COUNT
+ * @return true If the segment content must be written now, followed by EVE_Seg_end
+ */
+bool EVE_Seg_begin(EVE_HalContext *phost, uint8_t id)
+{
+	EVE_HalSeg *seg;
+	eve_assert(id < EVE_SEG_COUNT);
+	eve_assert(!phost->SegRecording);
+	seg = &phost->Seg[id];
+	if (seg->Size)
+		return false;
+
+	/* Recording writes to RAM_G, this frame cannot be skipped */
+	EVE_Cmd_framePresent(phost);
+
+	/* Capture the display list generated from here, its size is known before anything is written to RAM_G */
+	if (!EVE_Cmd_waitFlush(phost))
+		return false;
+	phost->SegStart = EVE_Hal_rd16(phost, REG_CMD_DL);
+	phost->SegRecording = id + 1;
+	return true;
+}
+
+/**
+ * @brief End recording the segment started by EVE_Seg_begin
+ *
+ * @param phost Pointer to Hal context
+ * @return true If the segment is retained
+ */
+bool EVE_Seg_end(EVE_HalContext *phost)
+{
+	EVE_HalSeg *seg;
+	uint8_t id;
+	uint32_t size;
+	uint32_t room;
+	eve_assert(phost->SegRecording);
+	id = phost->SegRecording - 1;
+	seg = &phost->Seg[id];
+	phost->SegRecording = 0;
+
+#if (EVE_SUPPORT_CHIPID >= EVE_BT817)
+	/* Keep room for the RETURN that ends a command list */
+	seg->List = EVE_CHIPID >= EVE_BT817;
+	room = seg->List ? (EVE_SEG_SIZE - 4) : EVE_SEG_SIZE;
+#else
+	room = EVE_SEG_SIZE;
+#endif
+
+	if (!EVE_Cmd_waitFlush(phost))
+		return false;
+	size = (EVE_Hal_rd16(phost, REG_CMD_DL) - phost->SegStart) & 0xFFFF;
+	if (!size || size > room)
+	{
+		/* Leave the content in the current display list, and record it again next time */
+		if (size)
+			eve_printf_debug("Retained segment %i overflows EVE_SEG_SIZE with %i bytes\n", (int)id, (int)size);
+		return false;
+	}
+	saveState(phost, seg);
+
+	/* Move the content out of the current display list, it is drawn by EVE_Seg_draw */
+	EVE_Hal_wr16(phost, REG_CMD_DL, (uint16_t)phost->SegStart);
+	EVE_CoCmd_memCpy(phost, EVE_SEG_ADDR_OF(id), RAM_DL + phost->SegStart, size);
+#if (EVE_SUPPORT_CHIPID >= EVE_BT817)
+	if (seg->List)
+	{
+		/* Terminate it the way CMD_ENDLIST does, so it can be replayed with CMD_CALLLIST */
+		EVE_CoCmd_memWrite32(phost, EVE_SEG_ADDR_OF(id) + size, RETURN());
+		size += 4;
+	}
+#endif
+	seg->Size = size;
+	return true;
+}
+
+/**
+ * @brief Draw a recorded segment with a single command
+ *
+ * @param phost Pointer to Hal context
+ * @param id Segment id, less than EVE_SEG_COUNT
+ */
+void EVE_Seg_draw(EVE_HalContext *phost, uint8_t id)
+{
+	EVE_HalSeg *seg;
+	eve_assert(id < EVE_SEG_COUNT);
+	seg = &phost->Seg[id];
+	if (!seg->Size)
+		return;
+
+#if (EVE_SUPPORT_CHIPID >= EVE_BT817)
+	if (seg->List)
+		EVE_CoCmd_callList(phost, EVE_SEG_ADDR_OF(id));
+	else
+#endif
+		EVE_CoCmd_append(phost, EVE_SEG_ADDR_OF(id), seg->Size);
+	restoreState(phost, seg);
+}
+
+/**
+ * @brief Discard a recorded segment
+ *
+ * @param phost Pointer to Hal context
+ * @param id Segment id, less than EVE_SEG_COUNT
+ */
+void EVE_Seg_invalidate(EVE_HalContext *phost, uint8_t id)
+{
+	eve_assert(id < EVE_SEG_COUNT);
+	phost->Seg[id].Size = 0;
+}
+
+/**
+ * @brief Discard all recorded segments
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Seg_invalidateAll(EVE_HalContext *phost)
+{
+	uint8_t id;
+	for (id = 0; id < EVE_SEG_COUNT; ++id)
+		phost->Seg[id].Size = 0;
+	phost->SegRecording = 0;
+}
+
+#endif
+
+/* end of file */
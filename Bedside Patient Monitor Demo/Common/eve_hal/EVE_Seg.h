@@ -0,0 +1,96 @@
+/**
+ * @file EVE_Seg.h
+ * @brief Retained display list segments
+ *
+ * Records a static part of a frame once into RAM_G, and replays it in later
+ * frames with a single command. The display list generated for the segment is
+ * measured through REG_CMD_DL, and only copied to RAM_G with CMD_MEMCPY when it
+ * fits in EVE_SEG_SIZE. On BT817 and later it is terminated with RETURN, the
+ * same layout as a list compiled by CMD_NEWLIST, and replayed with
+ * CMD_CALLLIST. On other chips it is replayed with CMD_APPEND.
+ *
+ * Usage, within a frame:
+ *
+ *     if (EVE_Seg_begin(phost, id))
+ *     {
+ *         ... static content ...
+ *         EVE_Seg_end(phost);
+ *     }
+ *     EVE_Seg_draw(phost, id);
+ *
+ * A segment must be drawn where the graphics state is the same as where it
+ * was recorded, as display list words that did not change the cached state
+ * are not recorded. Call EVE_Seg_invalidate when the content changes.
+ * Enable with EVE_SEG_COUNT in EVE_Config.h, RAM_G is reserved at EVE_SEG_ADDR.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EVE_SEG__H
+#define EVE_SEG__H
+#include "EVE_HalDefs.h"
+
+/*******************************
+** RETAINED DISPLAY SEGMENTS **
+*******************************/
+
+#if EVE_SEG_COUNT
+
+/** Start recording a segment, unless it is already recorded.
+Returns true when the segment content must be written now, followed by EVE_Seg_end.
+Returns false when the segment is already recorded, the content must then be skipped */
+bool EVE_Seg_begin(EVE_HalContext *phost, uint8_t id);
+
+/** End recording the segment started by EVE_Seg_begin.
+Returns false when the segment could not be retained, because it does not fit in EVE_SEG_SIZE
+or a coprocessor fault occurred. The segment is then recorded again on the next EVE_Seg_begin */
+bool EVE_Seg_end(EVE_HalContext *phost);
+
+/** Draw a recorded segment with a single command.
+Does nothing if the segment is not recorded */
+void EVE_Seg_draw(EVE_HalContext *phost, uint8_t id);
+
+/** Discard a recorded segment, for example when the layout changed */
+void EVE_Seg_invalidate(EVE_HalContext *phost, uint8_t id);
+
+/** Discard all recorded segments, for example when RAM_G was overwritten */
+void EVE_Seg_invalidateAll(EVE_HalContext *phost);
+
+#else
+
+/* Without retained segments, the content is written every frame */
+#define EVE_Seg_begin(phost, id) (true)
+#define EVE_Seg_end(phost) (false)
+#define EVE_Seg_draw(phost, id) eve_noop()
+#define EVE_Seg_invalidate(phost, id) eve_noop()
+#define EVE_Seg_invalidateAll(phost) eve_noop()
+
+#endif
+
+#endif /* #ifndef EVE_SEG__H */
+
+/* end of file */
@@ -157,6 +157,7 @@ static const char *s_HostDisplayNames[EVE_HOST_NB] = {
 	"FT4222",
 	"MPSSE",
 	"Embedded",
+	"Null Device",
 };
 
 #define EVE_SELECT_CHIP_NB 15
@@ -1750,6 +1751,12 @@ bool EVE_Util_resetCoprocessor(EVE_HalContext *phost)
 
 	/* Default */
 	phost->CmdFault = false;
+#if EVE_CMD_DEFER
+	phost->CmdDeferIndex = 0; /* Discard staged commands */
+#endif
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	phost->CmdFrameDone = phost->CmdFrameSubmitted; /* Pending frames are lost */
+#endif
 
 	/* Set REG_CPURESET to 0, to restart the coprocessor */
 	EVE_Hal_wr8(phost, REG_CPURESET, 0);
@@ -1843,6 +1850,7 @@ bool EVE_Util_resetCoprocessor(EVE_HalContext *phost)
 	debugRestoreRamG(phost);
 #endif
 	EVE_CoDlImpl_resetCoState(phost);
+	EVE_Seg_invalidateAll(phost); /* A segment may have been recorded partially */
 	return ready;
 }
 
@@ -410,7 +410,8 @@ inline static ft_int16_t Gpu_Hal_TransferString_S(EVE_HalContext *phost, const f
 typedef enum
 {
 	FLASH_CMD_SUCCESS = 0, /**< 0 */
-	FLASH_CMD_ALIGNED_ERR /**< 1 */
+	FLASH_CMD_ALIGNED_ERR, /**< 1 */
+	FLASH_CMD_FAULT_ERR /**< 2, coprocessor fault or timeout */
 } Flash_Cmd_Status_t;
 
 #define FLASH_WRITE_ALIGN_BYTE (256)
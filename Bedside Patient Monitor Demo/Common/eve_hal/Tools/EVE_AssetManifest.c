@@ -0,0 +1,238 @@
+/**
+ * @file EVE_AssetManifest.c
+ * @brief Generates the asset manifest header of a flash image
+ *
+ * Reads the .edf layout file written by EVE Asset Builder together with the
+ * flash image, and writes a C header for Asset.h: one ASSET_ id per extended
+ * font (.xfont) and raw bitmap (.raw), and a table with its flash offset, size
+ * including the padding, format and bitmap size. Glyphs stay in flash, the
+ * extended font header refers to them. The bitmap format and size are taken
+ * from the "_<w>x<h>_<format>.raw" suffix of the EAB file name.
+ * Standalone host tool, it does not link the eve_hal library. Built by the
+ * EVE_AssetManifest target when WITH_EVE_TOOLS is enabled.
+ * Usage: EVE_AssetManifest <image.edf> <header.h>
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MANIFEST_MAX_ASSETS 1024
+#define MANIFEST_NAME_SIZE 128
+
+typedef struct
+{
+	char name[MANIFEST_NAME_SIZE];
+	char id[MANIFEST_NAME_SIZE];
+	char format[MANIFEST_NAME_SIZE];
+	unsigned long offset;
+	unsigned long size;
+	unsigned width;
+	unsigned height;
+} ManifestAsset;
+
+static ManifestAsset s_assets[MANIFEST_MAX_ASSETS];
+
+/**
+ * @brief Remove leading and trailing blanks in place
+ *
+ * @param s String
+ * @return Trimmed string
+ */
+static char *manifestTrim(char *s)
+{
+	char *end;
+	while (isspace((unsigned char)*s))
+		++s;
+	end = s + strlen(s);
+	while (end > s && isspace((unsigned char)end[-1]))
+		--end;
+	*end = '\0';
+	return s;
+}
+
+/**
+ * @brief Check the suffix of a string
+ *
+ * @param s String
+ * @param suffix Suffix
+ * @return 1 if s ends with suffix
+ */
+static int manifestEndsWith(const char *s, const char *suffix)
+{
+	size_t len = strlen(s);
+	size_t suffixLen = strlen(suffix);
+	return len >= suffixLen && !strcmp(s + len - suffixLen, suffix);
+}
+
+/**
+ * @brief Fill the id, format and bitmap size of an asset from its name
+ *
+ * @param asset Asset, with the name set
+ */
+static void manifestDescribe(ManifestAsset *asset)
+{
+	char base[MANIFEST_NAME_SIZE];
+	char *p;
+	size_t i;
+
+	strcpy(base, asset->name);
+	*strrchr(base, '.') = '\0';
+	strcpy(asset->format, "ASSET_FORMAT_XFONT");
+	if (manifestEndsWith(asset->name, ".raw"))
+	{
+		/* Look for the "_<w>x<h>_<format>" suffix */
+		strcpy(asset->format, "ASSET_FORMAT_RAW");
+		for (p = strchr(base, '_'); p; p = strchr(p + 1, '_'))
+		{
+			unsigned w, h;
+			int n = 0;
+			if (sscanf(p, "_%ux%u_%n", &w, &h, &n) == 2 && n > 0 && p[n])
+			{
+				asset->width = w;
+				asset->height = h;
+				strcpy(asset->format, p + n);
+				*p = '\0';
+				break;
+			}
+		}
+	}
+
+	/* Identifier from what is left of the name */
+	strcpy(asset->id, "ASSET_");
+	for (i = 0; base[i] && i < MANIFEST_NAME_SIZE - 7; ++i)
+		asset->id[6 + i] = isalnum((unsigned char)base[i]) ? (char)toupper((unsigned char)base[i]) : '_';
+	asset->id[6 + i] = '\0';
+}
+
+int main(int argc, char *argv[])
+{
+	char line[512];
+	char guard[MANIFEST_NAME_SIZE];
+	const char *headerName;
+	const char *edfName;
+	FILE *edf;
+	FILE *header;
+	size_t count = 0;
+	size_t i;
+
+	if (argc < 3)
+	{
+		printf("Usage: EVE_AssetManifest <image.edf> <header.h>\n");
+		return EXIT_FAILURE;
+	}
+
+	edf = fopen(argv[1], "r");
+	if (!edf)
+	{
+		printf("Unable to open: %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	while (fgets(line, sizeof(line), edf))
+	{
+		/* Name : ID : Offset : Size : Compression : Type : Sub-Type : Width : Height */
+		char *field[4];
+		char *p = line;
+		int n;
+		for (n = 0; n < 4; ++n)
+		{
+			field[n] = p;
+			p = strchr(p, ':');
+			if (!p)
+				break;
+			*p++ = '\0';
+			field[n] = manifestTrim(field[n]);
+		}
+		if (n < 4)
+			continue;
+
+		if (manifestEndsWith(field[0], ".padding") && count)
+		{
+			/* Copied together with the asset, so the size stays aligned */
+			ManifestAsset *last = &s_assets[count - 1];
+			if (!strncmp(field[0], last->name, strlen(last->name)))
+				last->size += strtoul(field[3], NULL, 10);
+			continue;
+		}
+		if (!manifestEndsWith(field[0], ".xfont") && !manifestEndsWith(field[0], ".raw"))
+			continue;
+		if (count == MANIFEST_MAX_ASSETS || strlen(field[0]) >= MANIFEST_NAME_SIZE)
+		{
+			printf("Skipped: %s\n", field[0]);
+			continue;
+		}
+		strcpy(s_assets[count].name, field[0]);
+		s_assets[count].offset = strtoul(field[2], NULL, 10);
+		s_assets[count].size = strtoul(field[3], NULL, 10);
+		manifestDescribe(&s_assets[count]);
+		++count;
+	}
+	fclose(edf);
+
+	header = fopen(argv[2], "w");
+	if (!header)
+	{
+		printf("Unable to create: %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	/* Include guard from the file name */
+	headerName = strrchr(argv[2], '/');
+	headerName = headerName ? headerName + 1 : argv[2];
+	for (i = 0; headerName[i] && i < MANIFEST_NAME_SIZE - 2; ++i)
+		guard[i] = isalnum((unsigned char)headerName[i]) ? (char)toupper((unsigned char)headerName[i]) : '_';
+	guard[i++] = '_';
+	guard[i] = '\0';
+
+	edfName = strrchr(argv[1], '/');
+	edfName = edfName ? edfName + 1 : argv[1];
+	fprintf(header, "/* Generated by EVE_AssetManifest from %s, do not edit */\n\n", edfName);
+	fprintf(header, "#ifndef %s\n#define %s\n\n#include \"Asset.h\"\n\n", guard, guard);
+	fprintf(header, "enum\n{\n");
+	for (i = 0; i < count; ++i)
+		fprintf(header, "\t%s,\n", s_assets[i].id);
+	fprintf(header, "\tASSET_COUNT\n};\n\n");
+	fprintf(header, "static const Asset_Info_t s_assetManifest[ASSET_COUNT] = {\n");
+	for (i = 0; i < count; ++i)
+		fprintf(header, "\t{ \"%s\", %lu, %lu, %s, %u, %u },\n", s_assets[i].name,
+		    s_assets[i].offset, s_assets[i].size, s_assets[i].format, s_assets[i].width, s_assets[i].height);
+	fprintf(header, "};\n\n#endif /* %s */\n", guard);
+
+	if (fclose(header) != 0)
+	{
+		printf("Unable to write: %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+	printf("%s: %u assets\n", argv[2], (unsigned)count);
+	return EXIT_SUCCESS;
+}
+
+/* end of file */
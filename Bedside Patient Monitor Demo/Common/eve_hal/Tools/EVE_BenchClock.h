@@ -0,0 +1,89 @@
+/**
+ * @file EVE_BenchClock.h
+ * @brief Microsecond clock and cycle counter for the host benchmarks
+ *
+ * EVE_millis64 is too coarse to time a short benchmark pass, the result moves
+ * by a whole tick between runs. EVE_BenchClock_micros reads the finest
+ * monotonic clock of the host instead. EVE_BENCH_CYCLES reads the time stamp
+ * counter on x86, and is 0 where there is no cycle counter.
+ * Shared by the benchmark tools.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EVE_BENCH_CLOCK__H
+#define EVE_BENCH_CLOCK__H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(RP2040_PLATFORM)
+#include "pico/time.h"
+#else
+#include <time.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define EVE_BENCH_CYCLES() __rdtsc()
+#else
+#define EVE_BENCH_CYCLES() 0ULL
+#endif
+
+/**
+ * @brief Monotonic time in microseconds
+ */
+static inline uint64_t EVE_BenchClock_micros()
+{
+#if defined(_WIN32)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER now;
+	if (!frequency.QuadPart)
+		QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&now);
+	return (uint64_t)(now.QuadPart / frequency.QuadPart) * 1000000
+	    + (uint64_t)(now.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#elif defined(RP2040_PLATFORM)
+	return time_us_64();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+#endif
+}
+
+#endif /* #ifndef EVE_BENCH_CLOCK__H */
+
+/* end of file */
@@ -0,0 +1,132 @@
+/**
+ * @file EVE_CmdBench.c
+ * @brief Measures the host time spent encoding coprocessor commands
+ *
+ * Links the eve_hal library, preferably built for the NULLDEV platform, so
+ * the time is not dominated by the bus or the coprocessor. Built by the
+ * EVE_CmdBench target when WITH_EVE_TOOLS is enabled. Configure once with
+ * EVE_CMD_INLINE defined to 0 and once with it defined to 1 to compare the
+ * out-of-line command templates against the inlined ones.
+ * Usage: EVE_CmdBench [<frame count>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_Platform.h"
+#include "EVE_BenchClock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Number of commands emitted by one call to benchFrame */
+#define BENCH_FRAME_COMMANDS 12
+
+/**
+ * @brief Emit a frame worth of typical widget commands
+ *
+ * @param phost Pointer to Hal context
+ * @param i Frame index, varies the parameters so no state is cached
+ */
+static void benchFrame(EVE_HalContext *phost, uint32_t i)
+{
+	EVE_CoCmd_dlStart(phost);
+	EVE_CoCmd_fgColor(phost, 0x003870 + i);
+	EVE_CoCmd_bgColor(phost, 0x002040 + i);
+	EVE_CoCmd_button(phost, 10, 10, 120, 40, 28, 0, "OK");
+	EVE_CoCmd_progress(phost, 10, 60, 200, 12, 0, (uint16_t)(i & 0xFF), 255);
+	EVE_CoCmd_slider(phost, 10, 80, 200, 12, 0, (uint16_t)(i & 0xFF), 255);
+	EVE_CoCmd_gauge(phost, 300, 100, 60, 0, 10, 5, (uint16_t)(i & 0xFF), 255);
+	EVE_CoCmd_number(phost, 10, 120, 28, 0, (int32_t)i);
+	EVE_CoCmd_loadIdentity(phost);
+	EVE_CoCmd_translate(phost, 65536 * 10, 65536 * 20);
+	EVE_CoCmd_setMatrix(phost);
+	EVE_CoCmd_swap(phost);
+}
+
+int main(int argc, char *argv[])
+{
+	EVE_HalContext host;
+	EVE_HalContext *phost = &host;
+	uint32_t frames = 100000;
+	uint64_t startMicros;
+	uint64_t startCycles;
+	uint64_t micros;
+	uint64_t cycles;
+	uint32_t commands;
+	uint32_t i;
+
+	if (argc > 1)
+		frames = max(1, atoi(argv[1]));
+
+	EVE_Hal_initialize();
+	if (!EVE_Util_openDeviceInteractive(phost, NULL))
+	{
+		printf("Failed to open device\n");
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+	if (!EVE_Util_bootupConfig(phost))
+	{
+		printf("Failed to boot up device\n");
+		EVE_Hal_close(phost);
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+
+#if EVE_CMD_DEFER
+	/* Measure encoding, not the number of bus transfers */
+	EVE_Cmd_setDefer(phost, true);
+#endif
+
+	benchFrame(phost, 0); /* Warm up */
+	EVE_Cmd_waitFlush(phost);
+
+	startMicros = EVE_BenchClock_micros();
+	startCycles = EVE_BENCH_CYCLES();
+	for (i = 0; i < frames; ++i)
+		benchFrame(phost, i);
+	EVE_Cmd_waitFlush(phost);
+	cycles = EVE_BENCH_CYCLES() - startCycles;
+	micros = EVE_BenchClock_micros() - startMicros;
+
+	commands = frames * BENCH_FRAME_COMMANDS;
+	printf("EVE_CMD_INLINE %i: %u commands in %u us, %u ns per command",
+	    (int)EVE_CMD_INLINE, (unsigned)commands, (unsigned)micros,
+	    (unsigned)(micros * 1000 / commands));
+	if (cycles)
+		printf(", %u cycles per command", (unsigned)(cycles / commands));
+	printf("\n");
+
+#if EVE_CMD_DEFER
+	EVE_Cmd_setDefer(phost, false);
+#endif
+	EVE_Hal_close(phost);
+	EVE_Hal_release();
+	return EXIT_SUCCESS;
+}
+
+/* end of file */
@@ -0,0 +1,146 @@
+/**
+ * @file EVE_FlashManifest.c
+ * @brief Writes the sector CRC manifest of a flash image, for delta updates
+ *
+ * The manifest lets Ftf_Write_File_To_Flash_Delta program only the 4096-byte
+ * sectors of the flash whose content changed. It holds, as little-endian
+ * 32-bit words, the magic "EFCR", the sector size, the image size, and the
+ * CRC-32 of each sector, the same CRC-32 as computed by CMD_MEMCRC. The last
+ * sector may be partial. Flash_Init uses the manifest named after the image
+ * with ".crc" appended, when present.
+ * Standalone host tool, it does not link the eve_hal library. Built by the
+ * EVE_FlashManifest target when WITH_EVE_TOOLS is enabled.
+ * Usage: EVE_FlashManifest <image.bin> [<manifest>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MANIFEST_MAGIC 0x52434645 /* "EFCR" */
+#define MANIFEST_SECTOR_SIZE 4096
+
+/**
+ * @brief Compute the CRC-32 of a buffer, the same as CMD_MEMCRC
+ *
+ * @param data Data buffer
+ * @param size Size of the data
+ * @return CRC-32
+ */
+static uint32_t manifestCrc32(const uint8_t *data, size_t size)
+{
+	uint32_t crc = 0xFFFFFFFF;
+	int i;
+
+	while (size--)
+	{
+		crc ^= *data++;
+		for (i = 0; i < 8; ++i)
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+	return ~crc;
+}
+
+/**
+ * @brief Write a 32-bit word in little-endian order
+ *
+ * @param file Output file
+ * @param value Word to write
+ * @return 1 on success
+ */
+static int manifestWrite32(FILE *file, uint32_t value)
+{
+	uint8_t bytes[4];
+	bytes[0] = (uint8_t)value;
+	bytes[1] = (uint8_t)(value >> 8);
+	bytes[2] = (uint8_t)(value >> 16);
+	bytes[3] = (uint8_t)(value >> 24);
+	return fwrite(bytes, 1, 4, file) == 4;
+}
+
+int main(int argc, char *argv[])
+{
+	static uint8_t sector[MANIFEST_SECTOR_SIZE];
+	char manifestName[1024];
+	FILE *image;
+	FILE *manifest;
+	long size;
+	uint32_t sectors = 0;
+	size_t read;
+	int ok;
+
+	if (argc < 2)
+	{
+		printf("Usage: EVE_FlashManifest <image.bin> [<manifest>]\n");
+		return EXIT_FAILURE;
+	}
+	if (argc > 2)
+		snprintf(manifestName, sizeof(manifestName), "%s", argv[2]);
+	else
+		snprintf(manifestName, sizeof(manifestName), "%s.crc", argv[1]);
+
+	image = fopen(argv[1], "rb");
+	if (!image)
+	{
+		printf("Unable to open: %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	fseek(image, 0, SEEK_END);
+	size = ftell(image);
+	fseek(image, 0, SEEK_SET);
+
+	manifest = fopen(manifestName, "wb");
+	if (!manifest)
+	{
+		printf("Unable to create: %s\n", manifestName);
+		fclose(image);
+		return EXIT_FAILURE;
+	}
+
+	ok = manifestWrite32(manifest, MANIFEST_MAGIC)
+	    && manifestWrite32(manifest, MANIFEST_SECTOR_SIZE)
+	    && manifestWrite32(manifest, (uint32_t)size);
+	while (ok && (read = fread(sector, 1, sizeof(sector), image)) > 0)
+	{
+		ok = manifestWrite32(manifest, manifestCrc32(sector, read));
+		++sectors;
+	}
+
+	fclose(image);
+	if (fclose(manifest) != 0 || !ok)
+	{
+		printf("Unable to write: %s\n", manifestName);
+		remove(manifestName);
+		return EXIT_FAILURE;
+	}
+	printf("%s: %u bytes, %u sectors\n", manifestName, (unsigned)size, (unsigned)sectors);
+	return EXIT_SUCCESS;
+}
+
+/* end of file */
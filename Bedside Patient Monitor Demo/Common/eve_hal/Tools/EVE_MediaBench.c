@@ -0,0 +1,177 @@
+/**
+ * @file EVE_MediaBench.c
+ * @brief Measures the throughput of EVE_MediaFifo_stream
+ *
+ * Nothing consumes the media FIFO, the benchmark drains it from the wait
+ * callback, so on a device the result includes the bus transfers. On the
+ * NULLDEV platform, which drains the media FIFO instantly, only the host-side
+ * cost is measured. Streams a file, or a generated temporary file, once from
+ * memory and once from the file, and prints the throughput in MB/s.
+ * Links the eve_hal library, built by the EVE_MediaBench target when
+ * WITH_EVE_TOOLS is enabled. Configure once with the EVE_MEDIA_STREAM_THREAD
+ * CMake option off and once with it on to compare synchronous reads against
+ * reading ahead on the reader thread.
+ * Usage: EVE_MediaBench [<file>] [<megabytes>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_Platform.h"
+#include "EVE_BenchClock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Media FIFO used for the benchmark, at the start of RAM_G */
+#define BENCH_FIFO_ADDR RAM_G
+#define BENCH_FIFO_SIZE (256 * 1024)
+
+/**
+ * @brief Drain the media FIFO while EVE_MediaFifo_stream waits for space
+ *
+ * @param phost Pointer to Hal context
+ * @return true To continue waiting
+ */
+static bool benchDrain(EVE_HalContext *phost)
+{
+	EVE_Hal_wr32(phost, REG_MEDIAFIFO_READ, EVE_Hal_rd32(phost, REG_MEDIAFIFO_WRITE));
+	return true;
+}
+
+/**
+ * @brief Print the throughput of one run
+ *
+ * @param name Name of the source
+ * @param size Number of bytes streamed
+ * @param micros Duration in microseconds
+ */
+static void benchPrint(const char *name, uint32_t size, uint64_t micros)
+{
+	printf("EVE_MEDIA_STREAM_THREAD %i, %s: %u bytes in %u us, %.1f MB/s\n",
+	    (int)EVE_MEDIA_STREAM_THREAD, name, (unsigned)size, (unsigned)micros,
+	    micros ? (double)size / (1024.0 * 1024.0) * 1000000.0 / (double)micros : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+	EVE_HalContext host;
+	EVE_HalContext *phost = &host;
+	EVE_MediaSource source;
+	const char *filename = NULL;
+	uint32_t size = 64 * 1024 * 1024;
+	uint8_t *data;
+	FILE *file;
+	uint64_t startMicros;
+	uint32_t i;
+
+	if (argc > 1)
+		filename = argv[1];
+	if (argc > 2)
+		size = (uint32_t)max(1, atoi(argv[2])) * 1024 * 1024;
+
+	/* Prepare the data, both in memory and in a file */
+	if (filename)
+	{
+		file = fopen(filename, "rb");
+		if (!file)
+		{
+			printf("Unable to open: %s\n", filename);
+			return EXIT_FAILURE;
+		}
+		fseek(file, 0, SEEK_END);
+		size = min(size, (uint32_t)ftell(file));
+		fseek(file, 0, SEEK_SET);
+		data = (uint8_t *)malloc(size);
+		if (!data || fread(data, 1, size, file) != size)
+		{
+			printf("Unable to read: %s\n", filename);
+			fclose(file);
+			free(data);
+			return EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		file = tmpfile();
+		data = (uint8_t *)malloc(size);
+		if (!file || !data)
+		{
+			printf("Unable to create the test data\n");
+			if (file)
+				fclose(file);
+			free(data);
+			return EXIT_FAILURE;
+		}
+		for (i = 0; i < size; ++i)
+			data[i] = (uint8_t)(i * 2654435761UL >> 24);
+		fwrite(data, 1, size, file);
+	}
+
+	EVE_Hal_initialize();
+	if (!EVE_Util_openDeviceInteractive(phost, NULL))
+	{
+		printf("Failed to open device\n");
+		EVE_Hal_release();
+		fclose(file);
+		free(data);
+		return EXIT_FAILURE;
+	}
+	if (!EVE_Util_bootupConfig(phost)
+	    || !EVE_MediaFifo_set(phost, BENCH_FIFO_ADDR, BENCH_FIFO_SIZE))
+	{
+		printf("Failed to boot up device\n");
+		EVE_Hal_close(phost);
+		EVE_Hal_release();
+		fclose(file);
+		free(data);
+		return EXIT_FAILURE;
+	}
+
+	phost->CbCmdWait = benchDrain;
+
+	EVE_MediaSource_memory(&source, data, size);
+	startMicros = EVE_BenchClock_micros();
+	EVE_MediaFifo_stream(phost, &source, NULL);
+	EVE_MediaFifo_waitFlush(phost, false);
+	benchPrint("memory", size, EVE_BenchClock_micros() - startMicros);
+
+	fseek(file, 0, SEEK_SET);
+	EVE_MediaSource_file(&source, file, size);
+	startMicros = EVE_BenchClock_micros();
+	EVE_MediaFifo_stream(phost, &source, NULL);
+	EVE_MediaFifo_waitFlush(phost, false);
+	benchPrint("file", size, EVE_BenchClock_micros() - startMicros);
+
+	EVE_MediaFifo_close(phost);
+	EVE_Hal_close(phost);
+	EVE_Hal_release();
+	fclose(file);
+	free(data);
+	return EXIT_SUCCESS;
+}
+
+/* end of file */
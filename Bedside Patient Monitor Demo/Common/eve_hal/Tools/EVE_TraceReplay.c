@@ -0,0 +1,91 @@
+/**
+ * @file EVE_TraceReplay.c
+ * @brief Replays a transport trace recorded with EVE_HalTrace_start
+ *
+ * Sends the recorded transfers again, in order, through the backend the
+ * eve_hal library is built for (for example BT8XXEMU), to reproduce a
+ * session without the application. Built by the EVE_TraceReplay target when
+ * both WITH_EVE_TOOLS and EVE_HAL_TRACE are enabled.
+ * Usage: EVE_TraceReplay <trace file> [<repeat count>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_Platform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if EVE_HAL_TRACE
+
+int main(int argc, char *argv[])
+{
+	EVE_HalContext host;
+	EVE_HalContext *phost = &host;
+	int repeat = 1;
+	int failed = 0;
+	int i;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <trace file> [<repeat count>]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	if (argc > 2)
+		repeat = max(1, atoi(argv[2]));
+
+	EVE_Hal_initialize();
+	if (!EVE_Util_openDeviceInteractive(phost, NULL))
+	{
+		printf("Failed to open device\n");
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+
+	/* The device is only opened here. Start recording right after EVE_Hal_open,
+	so the trace contains the bootup sequence as well */
+	for (i = 0; i < repeat; ++i)
+	{
+		EVE_HalTraceStats stats;
+		if (!EVE_HalTrace_replay(phost, argv[1], &stats))
+		{
+			failed = 1;
+			break;
+		}
+		printf("Run %i: %u transfers, %u bytes written, %u bytes read, %u read mismatches, %u ms\n",
+		    i + 1, (unsigned)stats.Transfers, (unsigned)stats.BytesWritten, (unsigned)stats.BytesRead,
+		    (unsigned)stats.ReadMismatches, (unsigned)stats.Millis);
+	}
+
+	EVE_Hal_close(phost);
+	EVE_Hal_release();
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif
+
+/* end of file */
@@ -0,0 +1,267 @@
+/**
+ * @file EVE_TransferCheck.c
+ * @brief Checks the number of bus transfers the HAL issues
+ *
+ * Counts the transfers through the Transfers and CmdSpaceReads counters of
+ * EVE_HalStats, and fails when a batching path of the HAL issues more of
+ * them than expected. Runs against the platform the eve_hal library is built
+ * for, the NULLDEV platform or BT8XXEMU for a headless run.
+ * - Staging: a frame of display list words written one by one costs one
+ *   transfer per word, and a single burst per FIFO fill once staged.
+ * - Space reads: REG_CMDB_SPACE is read once per FIFO fill when written
+ *   word by word, and once per low-water refill with the mark set.
+ * - Register reads: EVE_Hal_rdRegs reads the touch registers in one
+ *   transfer, where reading them one by one takes one transfer each.
+ * Built by the EVE_TransferCheck target when WITH_EVE_TOOLS is enabled.
+ * Usage: EVE_TransferCheck
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_Platform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Display list words written by checkFrame */
+#define CHECK_FRAME_WORDS 400
+
+/** Frames written by checkSpaceReads */
+#define CHECK_SPACE_FRAMES 40
+
+/**
+ * @brief Write a frame of display list words, one EVE_Cmd_wr32 call each
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t Transfers issued until the frame reached the coprocessor
+ */
+static uint32_t checkFrame(EVE_HalContext *phost)
+{
+	EVE_HalStats stats;
+	uint32_t i;
+
+	EVE_Cmd_waitFlush(phost);
+	EVE_Hal_statsReset(phost);
+	EVE_CoCmd_dlStart(phost);
+	EVE_Cmd_wr32(phost, CLEAR(1, 1, 1));
+	EVE_Cmd_wr32(phost, BEGIN(POINTS));
+	for (i = 0; i < CHECK_FRAME_WORDS; i += 2)
+	{
+		EVE_Cmd_wr32(phost, COLOR_RGB(i & 0xFF, 0x80, 0x40));
+		EVE_Cmd_wr32(phost, VERTEX2F(i * 16, i * 8));
+	}
+	EVE_Cmd_wr32(phost, END());
+	EVE_Cmd_wr32(phost, DISPLAY());
+	EVE_CoCmd_swap(phost);
+#if EVE_CMD_DEFER
+	EVE_Cmd_commit(phost);
+#endif
+	EVE_Hal_statsSnapshot(phost, &stats);
+	EVE_Cmd_waitFlush(phost);
+	return stats.Transfers;
+}
+
+#if EVE_CMD_DEFER
+/**
+ * @brief Check that the staging buffer commits a frame in bursts
+ *
+ * @param phost Pointer to Hal context
+ * @return true If the staged frame took no more than two transfers per FIFO fill
+ */
+static bool checkStaging(EVE_HalContext *phost)
+{
+	const uint32_t bytes = (CHECK_FRAME_WORDS + 6) * 4;
+	const uint32_t bursts = bytes / (EVE_CMD_FIFO_SIZE - 4) + 1;
+	uint32_t direct;
+	uint32_t staged;
+
+	EVE_Cmd_setDefer(phost, false);
+	direct = checkFrame(phost);
+	EVE_Cmd_setDefer(phost, true);
+	staged = checkFrame(phost);
+	EVE_Cmd_setDefer(phost, false);
+
+	/* One write per burst, and at most one space read before it */
+	printf("Staging: %u transfers direct, %u staged\n", (unsigned)direct, (unsigned)staged);
+	return direct >= CHECK_FRAME_WORDS && staged <= 2 * bursts;
+}
+#endif
+
+/**
+ * @brief Write frames word by word, and count the free space reads
+ *
+ * @param phost Pointer to Hal context
+ * @param lowWater Low-water mark of the tracked space
+ * @param bytes Receives the bytes written into the FIFO
+ * @return uint32_t Space reads issued while writing
+ */
+static uint32_t checkSpaceFrames(EVE_HalContext *phost, uint16_t lowWater, uint32_t *bytes)
+{
+	EVE_HalStats stats;
+	uint32_t frame;
+	uint32_t i;
+
+	EVE_Cmd_waitFlush(phost);
+	EVE_Cmd_setSpaceLowWater(phost, lowWater);
+	EVE_Hal_statsReset(phost);
+	for (frame = 0; frame < CHECK_SPACE_FRAMES; ++frame)
+	{
+		EVE_CoCmd_dlStart(phost);
+		EVE_Cmd_wr32(phost, BEGIN(POINTS));
+		for (i = 0; i < CHECK_FRAME_WORDS; ++i)
+			EVE_Cmd_wr32(phost, VERTEX2F(i * 16, frame * 16));
+		EVE_Cmd_wr32(phost, END());
+		EVE_Cmd_wr32(phost, DISPLAY());
+		EVE_CoCmd_swap(phost);
+	}
+	EVE_Hal_statsSnapshot(phost, &stats);
+	EVE_Cmd_waitFlush(phost);
+	EVE_Cmd_setSpaceLowWater(phost, EVE_CMD_SPACE_LOW_WATER);
+	*bytes = stats.CmdBytes;
+	return stats.CmdSpaceReads;
+}
+
+/**
+ * @brief Check the free space reads with the low-water mark off and on
+ * Without the mark the space is read when a write no longer fits. With the
+ * mark it is read once the tracked space drops below the mark, so each read
+ * covers at least the FIFO size less the mark.
+ *
+ * @param phost Pointer to Hal context
+ * @return true If both stay within one read per refill
+ */
+static bool checkSpaceReads(EVE_HalContext *phost)
+{
+	const uint32_t lowWater = EVE_CMD_FIFO_SIZE >> 2;
+	uint32_t bytesOff, bytesOn;
+	uint32_t readsOff, readsOn;
+
+#if EVE_CMD_DEFER
+	EVE_Cmd_setDefer(phost, false);
+#endif
+	readsOff = checkSpaceFrames(phost, 0, &bytesOff);
+	readsOn = checkSpaceFrames(phost, (uint16_t)lowWater, &bytesOn);
+
+	printf("Space reads: %u for %u bytes with the low-water mark off, %u for %u bytes with it at %u\n",
+	    (unsigned)readsOff, (unsigned)bytesOff, (unsigned)readsOn, (unsigned)bytesOn, (unsigned)lowWater);
+	return readsOff <= bytesOff / (EVE_CMD_FIFO_SIZE - 4) + 1
+	    && readsOn <= bytesOn / (EVE_CMD_FIFO_SIZE - 4 - lowWater) + 1
+	    && readsOn >= readsOff;
+}
+
+/**
+ * @brief Check that EVE_Hal_rdRegs reads neighbouring registers in one transfer
+ *
+ * @param phost Pointer to Hal context
+ * @return true If the batched read took one transfer and matched the single reads
+ */
+static bool checkRdRegs(EVE_HalContext *phost)
+{
+	static const uint32_t regs[] = {
+		REG_TOUCH_TAG,
+		REG_TOUCH_SCREEN_XY,
+		REG_TOUCH_RAW_XY,
+		REG_TOUCH_TAG_XY,
+		REG_TOUCH_RZ,
+	};
+	const size_t n = sizeof(regs) / sizeof(regs[0]);
+	uint32_t single[sizeof(regs) / sizeof(regs[0])];
+	uint32_t batched[sizeof(regs) / sizeof(regs[0])];
+	EVE_HalStats stats;
+	uint32_t singleTransfers;
+	bool match = true;
+	size_t i;
+
+	EVE_Cmd_waitFlush(phost);
+	EVE_Hal_statsReset(phost);
+	for (i = 0; i < n; ++i)
+		single[i] = EVE_Hal_rd32(phost, regs[i]);
+	EVE_Hal_statsSnapshot(phost, &stats);
+	singleTransfers = stats.Transfers;
+
+	EVE_Hal_statsReset(phost);
+	EVE_Hal_rdRegs(phost, regs, batched, n);
+	EVE_Hal_statsSnapshot(phost, &stats);
+
+	for (i = 0; i < n; ++i)
+		match = match && single[i] == batched[i];
+	printf("Register reads: %u transfers one by one, %u batched%s\n",
+	    (unsigned)singleTransfers, (unsigned)stats.Transfers, match ? "" : ", values differ");
+	return singleTransfers == n && stats.Transfers == 1 && match;
+}
+
+int main(int argc, char *argv[])
+{
+	EVE_HalContext host;
+	EVE_HalContext *phost = &host;
+	int failed = 0;
+
+	(void)argc;
+	(void)argv;
+
+	EVE_Hal_initialize();
+	if (!EVE_Util_openDeviceInteractive(phost, NULL))
+	{
+		printf("Failed to open device\n");
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+	if (!EVE_Util_bootupConfig(phost))
+	{
+		printf("Failed to boot up device\n");
+		EVE_Hal_close(phost);
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+
+#if EVE_CMD_DEFER
+	if (!checkStaging(phost))
+	{
+		printf("FAILED: staged frame not committed in bursts\n");
+		++failed;
+	}
+#endif
+
+	if (!checkSpaceReads(phost))
+	{
+		printf("FAILED: free space read more than once per refill\n");
+		++failed;
+	}
+
+	if (!checkRdRegs(phost))
+	{
+		printf("FAILED: registers not read in one transfer\n");
+		++failed;
+	}
+
+	printf("%s\n", failed ? "Transfer check failed" : "Transfer check passed");
+	EVE_Hal_close(phost);
+	EVE_Hal_release();
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* end of file */
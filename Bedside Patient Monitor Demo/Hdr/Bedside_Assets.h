@@ -0,0 +1,162 @@
+/* Generated by EVE_AssetManifest from ew2025_bedside_patient_monitor_demo_bt81x.edf, do not edit */
+
+#ifndef BEDSIDE_ASSETS_H_
+#define BEDSIDE_ASSETS_H_
+
+#include "Asset.h"
+
+enum
+{
+	ASSET_ARIAL_1_ASTC,
+	ASSET_ARIAL_2_ASTC,
+	ASSET_ARIAL_3_ASTC,
+	ASSET_ARIAL_4_ASTC,
+	ASSET_ARIAL_5_ASTC,
+	ASSET_ARIAL_6_ASTC,
+	ASSET_ARIAL_7_ASTC,
+	ASSET_ARIAL_8_ASTC,
+	ASSET_ARIAL_9_ASTC,
+	ASSET_ARIAL_10_ASTC,
+	ASSET_ARIAL_11_ASTC,
+	ASSET_ARIAL_12_ASTC,
+	ASSET_ARIAL_13_ASTC,
+	ASSET_ARIAL_14_ASTC,
+	ASSET_ARIAL_15_ASTC,
+	ASSET_ARIAL_16_ASTC,
+	ASSET_ARIAL_17_ASTC,
+	ASSET_ARIAL_18_ASTC,
+	ASSET_ARIAL_19_ASTC,
+	ASSET_ARIAL_20_ASTC,
+	ASSET_ARIAL_21_ASTC,
+	ASSET_ARIAL_22_ASTC,
+	ASSET_ARIAL_23_ASTC,
+	ASSET_ARIAL_24_ASTC,
+	ASSET_ARIAL_25_ASTC,
+	ASSET_ARIAL_26_ASTC,
+	ASSET_ARIAL_27_ASTC,
+	ASSET_ARIAL_28_ASTC,
+	ASSET_ARIAL_29_ASTC,
+	ASSET_ARIAL_30_ASTC,
+	ASSET_ARIAL_31_ASTC,
+	ASSET_ARIAL_32_ASTC,
+	ASSET_ARIAL_33_ASTC,
+	ASSET_ARIAL_34_ASTC,
+	ASSET_ARIAL_35_ASTC,
+	ASSET_ARIAL_36_ASTC,
+	ASSET_ARIAL_37_ASTC,
+	ASSET_ARIAL_38_ASTC,
+	ASSET_ARIAL_39_ASTC,
+	ASSET_ARIAL_40_ASTC,
+	ASSET_ARIAL_41_ASTC,
+	ASSET_ARIAL_42_ASTC,
+	ASSET_ARIAL_43_ASTC,
+	ASSET_ARIAL_44_ASTC,
+	ASSET_ARIAL_45_ASTC,
+	ASSET_ARIAL_46_ASTC,
+	ASSET_ARIAL_47_ASTC,
+	ASSET_ARIAL_48_ASTC,
+	ASSET_ARIAL_49_ASTC,
+	ASSET_ARIAL_50_ASTC,
+	ASSET_ARIAL_51_ASTC,
+	ASSET_ARIAL_52_ASTC,
+	ASSET_ARIAL_53_ASTC,
+	ASSET_ARIAL_54_ASTC,
+	ASSET_ARIAL_55_ASTC,
+	ASSET_ARIAL_56_ASTC,
+	ASSET_ARIAL_57_ASTC,
+	ASSET_ARIAL_58_ASTC,
+	ASSET_ARIAL_59_ASTC,
+	ASSET_ARIAL_60_ASTC,
+	ASSET_ARIAL_61_ASTC,
+	ASSET_ARIAL_62_ASTC,
+	ASSET_ARIAL_63_ASTC,
+	ASSET_ARIAL_64_ASTC,
+	ASSET_ARIAL_65_ASTC,
+	ASSET_ARIAL_66_ASTC,
+	ASSET_ARIAL_67_ASTC,
+	ASSET_ARIAL_68_ASTC,
+	ASSET_ARIAL_69_ASTC,
+	ASSET_ARIAL_70_ASTC,
+	ASSET_ARIALNB_88_ASTC,
+	ASSET_ZOOM_IN_25_WHITE,
+	ASSET_ZOOM_OUT_25_WHITE,
+	ASSET_COUNT
+};
+
+static const Asset_Info_t s_assetManifest[ASSET_COUNT] = {
+	{ "arial_1_ASTC.xfont", 9920, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_2_ASTC.xfont", 15936, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_3_ASTC.xfont", 21952, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_4_ASTC.xfont", 27968, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_5_ASTC.xfont", 33984, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_6_ASTC.xfont", 40000, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_7_ASTC.xfont", 46016, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_8_ASTC.xfont", 63680, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_9_ASTC.xfont", 81344, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_10_ASTC.xfont", 99008, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_11_ASTC.xfont", 116672, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_12_ASTC.xfont", 134336, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_13_ASTC.xfont", 157824, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_14_ASTC.xfont", 181312, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_15_ASTC.xfont", 204800, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_16_ASTC.xfont", 228288, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_17_ASTC.xfont", 251776, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_18_ASTC.xfont", 310208, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_19_ASTC.xfont", 368640, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_20_ASTC.xfont", 427072, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_21_ASTC.xfont", 485504, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_22_ASTC.xfont", 543936, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_23_ASTC.xfont", 596544, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_24_ASTC.xfont", 649152, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_25_ASTC.xfont", 701760, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_26_ASTC.xfont", 771840, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_27_ASTC.xfont", 853568, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_28_ASTC.xfont", 935296, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_29_ASTC.xfont", 1017024, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_30_ASTC.xfont", 1098752, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_31_ASTC.xfont", 1180480, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_32_ASTC.xfont", 1273856, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_33_ASTC.xfont", 1367232, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_34_ASTC.xfont", 1460608, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_35_ASTC.xfont", 1565632, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_36_ASTC.xfont", 1723072, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_37_ASTC.xfont", 1880512, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_38_ASTC.xfont", 2037952, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_39_ASTC.xfont", 2195392, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_40_ASTC.xfont", 2341184, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_41_ASTC.xfont", 2486976, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_42_ASTC.xfont", 2632768, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_43_ASTC.xfont", 2807680, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_44_ASTC.xfont", 3000064, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_45_ASTC.xfont", 3192448, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_46_ASTC.xfont", 3384832, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_47_ASTC.xfont", 3577216, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_48_ASTC.xfont", 3787072, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_49_ASTC.xfont", 3996928, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_50_ASTC.xfont", 4206784, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_51_ASTC.xfont", 4416640, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_52_ASTC.xfont", 4643968, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_53_ASTC.xfont", 4947008, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_54_ASTC.xfont", 5250048, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_55_ASTC.xfont", 5553088, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_56_ASTC.xfont", 5856128, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_57_ASTC.xfont", 6141696, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_58_ASTC.xfont", 6427264, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_59_ASTC.xfont", 6712832, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_60_ASTC.xfont", 7039168, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_61_ASTC.xfont", 7388800, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_62_ASTC.xfont", 7738432, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_63_ASTC.xfont", 8088064, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_64_ASTC.xfont", 8437696, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_65_ASTC.xfont", 8810624, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_66_ASTC.xfont", 9183552, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_67_ASTC.xfont", 9556480, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_68_ASTC.xfont", 9952704, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_69_ASTC.xfont", 10447936, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "arial_70_ASTC.xfont", 10943168, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "ARIALNB_88_ASTC.xfont", 11009920, 192, ASSET_FORMAT_XFONT, 0, 0 },
+	{ "zoom-in-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw", 11010112, 832, COMPRESSED_RGBA_ASTC_4x4_KHR, 28, 28 },
+	{ "zoom-out-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw", 11010944, 832, COMPRESSED_RGBA_ASTC_4x4_KHR, 28, 28 },
+};
+
+#endif /* BEDSIDE_ASSETS_H_ */
@@ -55,4 +55,19 @@ extern int32_t g_graph_zoom_lv;
 
 extern uint8_t btnStartState;
 
+// Simulated signals, Src/Data_Simulate.c
+#define SIGNAL_ECG 0
+#define SIGNAL_PLETH 1
+#define SIGNAL_CO2 2
+
+typedef struct
+{
+	const SIGNALS_DATA_TYPE *samples;
+	int32_t sample_total;
+	int32_t sample_offset;
+} data_simulate_t;
+
+int32_t data_simulate_init(data_simulate_t *sim, int32_t signal);
+int32_t data_simulate_read(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count);
+
 #endif /* BEDSIDE_PATIENT_MONITOR_DEMO_H_ */
@@ -0,0 +1,53 @@
+﻿/**
+ * @file Data_Acquire.h
+ * @brief Simulated acquisition feeding one sample ring per signal
+ *
+ * Stands in for the sensor side of the monitor: each signal is sampled at its
+ * own rate into a sample_ring_t, which the waveform channels drain once per
+ * frame. On Linux the acquisition runs on its own thread, polling every
+ * DATA_ACQUIRE_PERIOD_MS, like an acquisition thread or timer interrupt would.
+ * Elsewhere data_acquire_step polls it from the main loop.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#ifndef DATA_ACQUIRE_H_
+#define DATA_ACQUIRE_H_
+
+#include "Bedside_Patient_Monitor_Demo.h"
+#include "Sample_Ring.h"
+
+#define DATA_ACQUIRE_MAX 4			// signals acquired at once
+#define DATA_ACQUIRE_RING_SIZE 1024 // samples buffered per signal, a power of 2
+#define DATA_ACQUIRE_PERIOD_MS 1	// poll period of the acquisition thread
+
+#ifndef DATA_ACQUIRE_THREAD
+#if defined(__linux__)
+#define DATA_ACQUIRE_THREAD 1 // acquire on a pthread, otherwise from data_acquire_step
+#else
+#define DATA_ACQUIRE_THREAD 0
+#endif
+#endif
+
+typedef struct
+{
+	data_simulate_t sim;
+	sample_ring_t ring;
+	SIGNALS_DATA_TYPE buffer[DATA_ACQUIRE_RING_SIZE];
+	int32_t sample_rate;
+	int32_t sample_frac;
+	uint32_t time_last_ms;
+} data_acquire_t;
+
+int32_t data_acquire_init(data_acquire_t *acq, int32_t signal);
+void data_acquire_poll(data_acquire_t *acq, uint32_t now_ms);
+void data_acquire_start(data_acquire_t **acqs, int32_t count);
+void data_acquire_stop();
+void data_acquire_step();
+
+#endif /* DATA_ACQUIRE_H_ */
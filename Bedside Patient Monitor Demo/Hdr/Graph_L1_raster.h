@@ -0,0 +1,25 @@
+﻿/**
+ * @file Graph_L1_raster.h
+ * @brief Span rasteriser for the 1-bpp (L1) waveform buffers
+ *
+ * A waveform sample is drawn as the segment from the previous sample, over a
+ * number of buffer rows set by the zoom level. Each row gets one horizontal
+ * span of pixels, written with byte masks, without per-pixel calls.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#ifndef GRAPH_L1_RASTER_H_
+#define GRAPH_L1_RASTER_H_
+
+#include <stdint.h>
+
+void graph_raster_span(uint8_t *row, int32_t width, int32_t x0, int32_t x1);
+void graph_raster_segment(uint8_t *rows, int32_t stride, int32_t row_count, int32_t width, int32_t x_from, int32_t x_to);
+
+#endif /* GRAPH_L1_RASTER_H_ */
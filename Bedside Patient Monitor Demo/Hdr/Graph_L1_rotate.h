@@ -0,0 +1,47 @@
+﻿/**
+ * @file Graph_L1_rotate.h
+ * @brief Waveform channels drawn as L1 rotated graphs
+ *
+ * Each channel keeps its waveform in its own RAM_G ring. The channels are
+ * registered with wave_channel_create and all processed by one call to
+ * graph_l1_rotate_draw per frame, sharing the host scratch buffers.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#ifndef GRAPH_L1_ROTATE_H_
+#define GRAPH_L1_ROTATE_H_
+
+#include "Helpers.h"
+#include "Bedside_Patient_Monitor_Demo.h"
+
+#define WAVE_CHANNEL_MAX 12
+
+typedef struct
+{
+	int32_t min;
+	int32_t max;
+} wave_range_t;
+
+/**
+ * @brief Fills samples with up to count new samples of a channel
+ *
+ * @return The number of samples written
+ */
+typedef int32_t (*wave_source_t)(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count);
+
+typedef struct wave_channel wave_channel_t;
+
+void graph_l1_rotate_init();
+wave_channel_t *wave_channel_create(app_box *box, uint32_t colour, int32_t sample_rate, wave_range_t range);
+void wave_channel_source(wave_channel_t *channel, wave_source_t source, void *ctx);
+void wave_channel_draw_all(uint32_t now_ms);
+void graph_l1_rotate_draw();
+void graph_l1_rotate_stats(uint32_t *bytes, uint32_t *writes);
+
+#endif /* GRAPH_L1_ROTATE_H_ */
@@ -132,6 +132,9 @@ typedef struct
 // Function to calculate and return FPS without float/double
 int32_t getFPS();
 
+// Function to draw the HAL performance counters collected since the previous call
+void showHalStats(EVE_HalContext *phost, int16_t x, int16_t y);
+
 // Function to format the date
 char *dd_mm_yyyy();
 char *dd_mmm_yyyy();
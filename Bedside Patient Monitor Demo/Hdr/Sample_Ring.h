@@ -0,0 +1,60 @@
+﻿/**
+ * @file Sample_Ring.h
+ * @brief Lock-free single producer, single consumer ring of waveform samples
+ *
+ * An acquisition context, an interrupt handler or a thread, pushes samples
+ * while the render loop pops them, without locks. The producer alone writes
+ * the head index and the consumer alone writes the tail index, each on its own
+ * cache line, so the two sides do not invalidate each other's line on every
+ * sample. Samples pushed to a full ring are dropped and counted as overruns.
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#ifndef SAMPLE_RING_H_
+#define SAMPLE_RING_H_
+
+#include <stdint.h>
+
+#include "Bedside_Patient_Monitor_Demo.h"
+
+#define SAMPLE_RING_CACHE_LINE 64
+
+#if defined(_MSC_VER)
+// accessed with __iso_volatile loads and stores and a fence, see Sample_Ring.c
+typedef volatile uint32_t sample_ring_index_t;
+#define SAMPLE_RING_ALIGNED __declspec(align(SAMPLE_RING_CACHE_LINE))
+#else
+#include <stdatomic.h>
+typedef _Atomic uint32_t sample_ring_index_t;
+#define SAMPLE_RING_ALIGNED _Alignas(SAMPLE_RING_CACHE_LINE)
+#endif
+
+typedef struct
+{
+	// set by sample_ring_init, read only afterwards
+	SIGNALS_DATA_TYPE *buffer;
+	uint32_t mask; // size - 1, the size is a power of 2
+
+	// producer cache line
+	SAMPLE_RING_ALIGNED sample_ring_index_t head; // samples pushed, free running
+	sample_ring_index_t overruns;				  // samples dropped because the ring was full
+	sample_ring_index_t peak;					  // most samples waiting at once
+
+	// consumer cache line
+	SAMPLE_RING_ALIGNED sample_ring_index_t tail; // samples popped, free running
+} sample_ring_t;
+
+int32_t sample_ring_init(sample_ring_t *ring, SIGNALS_DATA_TYPE *buffer, uint32_t size);
+int32_t sample_ring_push(sample_ring_t *ring, const SIGNALS_DATA_TYPE *samples, int32_t count);
+int32_t sample_ring_pop(sample_ring_t *ring, SIGNALS_DATA_TYPE *samples, int32_t count);
+uint32_t sample_ring_level(sample_ring_t *ring);
+void sample_ring_stats(sample_ring_t *ring, uint32_t *overruns, uint32_t *peak);
+int32_t sample_ring_read(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count);
+
+#endif /* SAMPLE_RING_H_ */
@@ -20,12 +20,16 @@
 #include "Bedside_Patient_Monitor_Demo.h"
 #include "Helpers.h"
 #include "Gesture.h"
+#include "Bedside_Assets.h"
+#include "Graph_L1_rotate.h"
+#include "Data_Acquire.h"
 
 // Definitions -------------------------------------------
-#define F_ADDR 0
-#define F_SIZE 1
 #define ENABLE_FONT_CACHE 1
+#define FONT_CACHE_MAX_SIZE (256 * 1024) // the font cache grows up to this size while it is full
+#define ASSET_POOL_SIZE (16 * 1024) // RAM_G for the fonts and icons copied from flash
 #define ENABLE_SHOW_FPS 0
+#define ENABLE_SHOW_HAL_STATS 0
 
 #define MONTH_MODE_DIGIT 0
 #define MONTH_MODE_STR3 1
@@ -37,30 +41,20 @@
 
 #define COLOR_CODE_WINDOW_BAR COLOR_RGB(0, 120, 215)
 
+// Retained display list segments, static parts of the frame
+#define SEG_BACKGROUND 0
+#define SEG_CHROME 1
+
 // Structs -----------------------------------------------
 typedef struct
 {
-	uint32_t flash_addr;
-	uint32_t flash_size;
-
-	uint32_t xfont_addr;
-	uint32_t xfont_size;
+	uint16_t asset; // .xfont in the asset manifest
 	uint32_t handler;
-	uint32_t *xfont;
-	uint32_t cache_addr;
-	uint32_t cache_size;
 } app_font_t;
 
-typedef struct
-{
-	uint32_t ramg_address;
-	uint32_t flash_address;
-	uint32_t size_on_flash;
-} app_image_from_flash_t;
-
 // Function declarations ---------------------------------
-uint32_t graph_l1_rotate_init(app_box *box_heartbeat, app_box *box_pleth, app_box *box_co2);
-void graph_l1_rotate_draw();
+void use_app_font(app_font_t *f);
+void create_wave_channels();
 
 // Variables ---------------------------------------------
 EVE_HalContext s_halContext;
@@ -68,28 +62,19 @@ EVE_HalContext *s_pHalContext;
 uint8_t time_mode = TIME_MODE_HH_MM;
 uint8_t month_mode = MONTH_MODE_DIGIT;
 
-/* Font and image data from ew2025_bedside_patient_monitor_demo_bt81x.map
-	arial_25_ASTC.glyph                                              : 649344   : 52416
-	arial_25_ASTC.xfont                                              : 701760   : 176
-	arial_25_ASTC.xfont.padding                                      : 701936   : 16
-	ARIALNB_88_ASTC.glyph                                            : 10943360 : 66560
-	ARIALNB_88_ASTC.xfont                                            : 11009920 : 176
-	ARIALNB_88_ASTC.xfont.padding                                    : 11010096 : 16
-	zoom-in-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw          : 11010112 : 784
-	zoom-in-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw.padding  : 11010896 : 48
-	zoom-out-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw         : 11010944 : 784
-	zoom-out-25-white_28x28_COMPRESSED_RGBA_ASTC_4x4_KHR.raw.padding : 11011728 : 48
-*/
-static const uint32_t arial_25_ASTC_xfont[] = {701760, 176};
-static const uint32_t ARIALNB_88_ASTC_xfont[] = {11009920, 176};
-app_image_from_flash_t zoom_in = {0, 11010112, 784 + 48};
-app_image_from_flash_t zoom_out = {0, 11010944, 784 + 48};
+/* Font and image data are located through Hdr/Bedside_Assets.h, generated from
+	Test/Flash/ew2025_bedside_patient_monitor_demo_bt81x.edf with Common/eve_hal/Tools/EVE_AssetManifest.c,
+	and copied into RAM_G when first drawn */
 
 // Font list
-app_font_t font0 = {.xfont = &ARIALNB_88_ASTC_xfont};
-app_font_t font2 = {.xfont = &arial_25_ASTC_xfont};
+app_font_t font0 = {.asset = ASSET_ARIALNB_88_ASTC};
+app_font_t font2 = {.asset = ASSET_ARIAL_25_ASTC};
 app_font_t *fonts[] = {&font0, &font2};
 
+// Characters drawn with each font, loaded into the font cache before the first frame
+const char *const font0_glyphs[] = {"0123456789"};
+const char *const font2_glyphs[] = {"0123456789", "ECG PLETH CO2 HR bpm spO2 % etCO2 mmHg NIBP sys dias"};
+
 int32_t g_graph_zoom_lv = 3;
 
 app_box box_menu_top;
@@ -105,69 +90,95 @@ uint8_t *const btnStartTxtActive = "START";
 uint8_t *const btnStartTxtInActive = "STOP";
 uint8_t *btnStartTxt = 0;
 uint8_t btnStartState = BTN_START_INACTIVE;
-uint32_t graph_size_ramg = 0;
+uint32_t asset_pool_ramg = EVE_RAMG_NULL;
+data_acquire_t acq_ecg;
+data_acquire_t acq_pleth;
+data_acquire_t acq_co2;
+
+void create_wave_channels()
+{
+	app_box *boxes[] = {&box_graph_ecg, &box_graph_pth, &box_graph_co2};
+	data_acquire_t *acqs[] = {&acq_ecg, &acq_pleth, &acq_co2};
+	int32_t signals[] = {SIGNAL_ECG, SIGNAL_PLETH, SIGNAL_CO2};
+	uint32_t colors[] = {0x00ff0000, 0x00ffff00, 0xffff0000};
+
+	int32_t count = 0;
+
+	// release the previous channels, then one channel per graph box, each with its own RAM_G ring
+	data_acquire_stop();
+	graph_l1_rotate_init();
+	for (uint32_t i = 0; i < sizeof(boxes) / sizeof(app_box *); i++)
+	{
+		data_acquire_init(acqs[i], signals[i]);
+		// paced by the acquisition, the channel drains the samples in its ring
+		wave_channel_t *ch = wave_channel_create(boxes[i], colors[i], 0, (wave_range_t){0, 255});
+		if (!ch)
+		{
+			printf("Warning: RAMG full\n");
+			break;
+		}
+		wave_channel_source(ch, sample_ring_read, &acqs[i]->ring);
+		count++;
+	}
+	data_acquire_start(acqs, count);
+}
 
-void load_app_assets(uint32_t ramg_offset)
+void load_app_assets()
 {
 	// font addr calculation
 	const uint8_t font_handler_start = 9;
 	uint32_t num_font = sizeof(fonts) / sizeof(app_font_t *);
 
-	// prepare the font
+	uint32_t font_handlers[sizeof(fonts) / sizeof(app_font_t *)];
+
+	// prepare the font handlers, the fonts are bound when first drawn, release the previous layout
 	for (int32_t i = 0; i < num_font; i++)
 	{
 		app_font_t *f = fonts[i];
 
-		f->flash_addr = f->xfont[F_ADDR];
-		f->flash_size = f->xfont[F_SIZE];
 		f->handler = i + font_handler_start;
-		f->xfont_addr = ALIGN_UP_TO_N(ramg_offset, 32); // SetFont2 32 bit align
-		f->xfont_size = f->flash_size;
-		ramg_offset = f->xfont_addr + f->xfont_size;
-
-		// prepare font handler
-		Display_Start(s_pHalContext);
-		EVE_CoCmd_flashRead(s_pHalContext, f->xfont_addr, f->flash_addr, f->flash_size);
-		EVE_CoCmd_setFont2(s_pHalContext, f->handler, f->xfont_addr, 0);
-		Display_End(s_pHalContext);
+		font_handlers[i] = f->handler;
 	}
+	FontCache_Release(s_pHalContext);
+	EVE_RamG_free(s_pHalContext, asset_pool_ramg);
 
-	// zoom icon
-	zoom_in.ramg_address = ramg_offset;
-	zoom_out.ramg_address = zoom_in.ramg_address + zoom_in.size_on_flash;
-	EVE_CoCmd_flashRead(s_pHalContext, zoom_in.ramg_address, zoom_in.flash_address, zoom_in.size_on_flash);
-	EVE_CoCmd_flashRead(s_pHalContext, zoom_out.ramg_address, zoom_out.flash_address, zoom_out.size_on_flash);
+	// fonts and icons are copied from flash into this pool when first drawn
+	asset_pool_ramg = EVE_RamG_alloc(s_pHalContext, ASSET_POOL_SIZE, ASSET_ALIGN);
+	if (asset_pool_ramg == EVE_RAMG_NULL)
+	{
+		printf("Warning: RAMG full\n");
+		Asset_Init(s_pHalContext, s_assetManifest, ASSET_COUNT, 0, 0);
+	}
+	else
+	{
+		Asset_Init(s_pHalContext, s_assetManifest, ASSET_COUNT, asset_pool_ramg, ASSET_POOL_SIZE);
+	}
 
 #if ENABLE_FONT_CACHE
-	// caching the font, only BT817/8, BT82x incompatible
-	ramg_offset += zoom_in.size_on_flash + zoom_out.size_on_flash;
-	uint32_t ramg_remain = RAM_G_SIZE - ramg_offset;
-	uint32_t cache_size_per_font = ramg_remain / num_font;
-	for (int32_t i = 0; i < num_font; i++)
+	// caching the font, only BT817/8, BT82x incompatible, one font at a time
+	// the fonts take turns holding the cache, then it is fitted to the glyphs in use and the rest of RAM_G goes back to the heap
+	FontCache_Init(s_pHalContext, font_handlers, num_font, FONT_CACHE_MAX_SIZE);
+	FontCache_Prewarm(s_pHalContext, font0.handler, font0_glyphs, sizeof(font0_glyphs) / sizeof(font0_glyphs[0]));
+	FontCache_Prewarm(s_pHalContext, font2.handler, font2_glyphs, sizeof(font2_glyphs) / sizeof(font2_glyphs[0]));
+
+	// bind the fonts now, the cache is pre-warmed when its font is bound
+	for (uint32_t i = 0; i < num_font; i++)
 	{
-		app_font_t *f = fonts[i];
-
-		uint32_t cache_size = min(cache_size_per_font, RAM_G_SIZE - ramg_offset);
-		if (cache_size < 16 * 1024)
-		{
-			printf("Warning: RAMG free < 16Kb\n");
-			break;
-		}
-		if (ramg_offset > RAM_G_SIZE)
-		{
-			printf("Warning: RAMG full\n");
-			break;
-		}
-
-		f->cache_addr = ALIGN_UP_TO_N(ramg_offset, 64); // 64-byte aligned.
-		f->cache_size = ALIGN_UP_TO_N(cache_size, 4);	// 4 byte aligned. Must be at least 16 Kbytes.
-
-		Display_Start(s_pHalContext);
-		EVE_CoCmd_fontCache(s_pHalContext, f->handler, f->cache_addr, f->cache_size);
-		Display_End(s_pHalContext);
-		ramg_offset = f->cache_addr + f->cache_size;
+		use_app_font(fonts[i]);
 	}
 #endif
+#if defined(_DEBUG)
+	EVE_RamG_dump(s_pHalContext);
+#endif
+}
+
+void use_app_font(app_font_t *f)
+{
+	// bind the font when its xfont was just copied into RAM_G, the font cache follows the binding
+	if (Asset_Font(s_pHalContext, f->asset, f->handler))
+	{
+		FontCache_Bound(s_pHalContext, f->handler);
+	}
 }
 
 void draw_app_window(app_box app_window)
@@ -228,8 +239,9 @@ void process_event()
 		// Swift 300 pixels to active the date time adjustment window
 		dateime_adjustment(s_pHalContext);
 		// reset graph before active the graph window again
-		graph_size_ramg = graph_l1_rotate_init(&box_graph_ecg, &box_graph_pth, &box_graph_co2);
-		load_app_assets(graph_size_ramg);
+		create_wave_channels();
+		load_app_assets();
+		EVE_Seg_invalidateAll(s_pHalContext);
 	}
 }
 
@@ -295,7 +307,10 @@ int32_t main(int32_t argc, char *argv[])
 	// read and store calibration setting
 	Calibration_New(s_pHalContext);
 	Flash_Init(s_pHalContext, TEST_DIR "ew2025_bedside_patient_monitor_demo_bt81x.bin", "ew2025_bedside_patient_monitor_demo_bt81x.bin", 0);
+#if !defined(NULLDEV_PLATFORM)
+	// The headless device does not model flash, it always reports full mode
 	FlashHelper_SwitchFullMode(s_pHalContext);
+#endif
 
 	// register big font 32 33 34
 	Display_Start(s_pHalContext);
@@ -350,68 +365,94 @@ int32_t main(int32_t argc, char *argv[])
 
 	static int32_t screenshot_counter = 0;
 
-	graph_size_ramg = graph_l1_rotate_init(&box_graph_ecg, &box_graph_pth, &box_graph_co2);
-	load_app_assets(graph_size_ramg);
+	create_wave_channels();
+	load_app_assets();
+
+#if EVE_CMD_DEFER
+	// Stage each frame in host memory, the FIFO is written in bursts
+	EVE_Cmd_setDefer(s_pHalContext, true);
+#endif
+#if EVE_CMD_FRAME_SKIP
+	// Frames identical to the one on screen are not sent, refresh at least once per second
+	EVE_Cmd_setFrameSkip(s_pHalContext, true, 1000);
+#endif
 
 	while (1)
 	{
 		Display_Start(s_pHalContext);
 		EVE_Cmd_wr32(s_pHalContext, VERTEX_FORMAT(EVE_VERTEX_FORMAT));
+		Asset_Next_Frame();
+#if ENABLE_FONT_CACHE
+		FontCache_Update(s_pHalContext);
+#endif
 
 		process_event();
 
-		draw_app_window(app_window);
+		// Window and grid, recorded once and replayed every frame
+		if (EVE_Seg_begin(s_pHalContext, SEG_BACKGROUND))
+		{
+			draw_app_window(app_window);
 
-		// the grid
-		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
-		EVE_Cmd_wr32(s_pHalContext, COLOR_A(100));
-		draw_grid_box(box_graph_ecg);
-		draw_grid_box(box_graph_pth);
-		draw_grid_box(box_graph_co2);
-		EVE_Cmd_wr32(s_pHalContext, LINE_WIDTH(16)); // reset line_width, without this, graphics become transparent 50%
-		EVE_Cmd_wr32(s_pHalContext, COLOR_A(255));
+			// the grid
+			EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
+			EVE_Cmd_wr32(s_pHalContext, COLOR_A(100));
+			draw_grid_box(box_graph_ecg);
+			draw_grid_box(box_graph_pth);
+			draw_grid_box(box_graph_co2);
+			EVE_Cmd_wr32(s_pHalContext, LINE_WIDTH(16)); // reset line_width, without this, graphics become transparent 50%
+			EVE_Cmd_wr32(s_pHalContext, COLOR_A(255));
+			EVE_Seg_end(s_pHalContext);
+		}
+		EVE_Seg_draw(s_pHalContext, SEG_BACKGROUND);
 
+		data_acquire_step();
 		graph_l1_rotate_draw();
 
-		// Top menu box
-		EVE_Cmd_wr32(s_pHalContext, COLOR_CODE_WINDOW_BAR);
-		DRAW_BOX(box_menu_top);
-		// Bottom menu box
-		DRAW_BOX(box_menu_bottom);
-
-		int32_t graph_border = 3;
-		int32_t brace_y = box_ecg.h / 7, brace_w = 5, brace_h = box_ecg.h * 4 / 5;
+		// Menu bars, braces and boxes, recorded once and replayed every frame
+		if (EVE_Seg_begin(s_pHalContext, SEG_CHROME))
+		{
+			// Top menu box
+			EVE_Cmd_wr32(s_pHalContext, COLOR_CODE_WINDOW_BAR);
+			DRAW_BOX(box_menu_top);
+			// Bottom menu box
+			DRAW_BOX(box_menu_bottom);
 
-		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
-		// Graph ECG braces outside
-		DRAW_RECT(box_ecg.x, box_ecg.y + brace_y, brace_w, brace_h);
-		// Graph pleth braces outside
-		DRAW_RECT(box_pth.x, box_pth.y + brace_y, brace_w, brace_h);
-		// Graph co2 braces outside
-		DRAW_RECT(box_co2.x, box_co2.y + brace_y, brace_w, brace_h);
+			int32_t graph_border = 3;
+			int32_t brace_y = box_ecg.h / 7, brace_w = 5, brace_h = box_ecg.h * 4 / 5;
 
-		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(0, 0, 0));
-		// Graph ecg braces inside
-		DRAW_RECT(box_ecg.x + graph_border, box_ecg.y + brace_y + border, brace_w, brace_h - border * 2);
-		// Graph pleth braces inside
-		DRAW_RECT(box_pth.x + graph_border, box_pth.y + brace_y + border, brace_w, brace_h - border * 2);
-		// Graph co2 braces inside
-		DRAW_RECT(box_co2.x + graph_border, box_co2.y + brace_y + border, brace_w, brace_h - border * 2);
-
-		EVE_Cmd_wr32(s_pHalContext, COLOR_CODE_WINDOW_BAR);
-		// right menu top
-		DRAW_RECT(box_menu_top.x_end, box_menu_top.y, WINDOW_W - box_menu_top.w, box_menu_top.h);
-		// right menu bottom
-		DRAW_RECT_BORDER(box_menu_bottom.x_end, box_menu_bottom.y, WINDOW_W - box_menu_bottom.w, box_menu_bottom.h, 0x0078d7, border, 0xffffff);
-
-		// right menu HR
-		DRAW_BOX_BORDER(box_right1, 0x000000, border, 0xffffff);
-		// right menu spO2
-		DRAW_BOX_BORDER(box_right2, 0x000000, border, 0xffffff);
-		// right menu etCO2
-		DRAW_BOX_BORDER(box_right3, 0x000000, border, 0xffffff);
-		// right menu NIBP
-		DRAW_BOX_BORDER(box_right4, 0x000000, border, 0xffffff);
+			EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
+			// Graph ECG braces outside
+			DRAW_RECT(box_ecg.x, box_ecg.y + brace_y, brace_w, brace_h);
+			// Graph pleth braces outside
+			DRAW_RECT(box_pth.x, box_pth.y + brace_y, brace_w, brace_h);
+			// Graph co2 braces outside
+			DRAW_RECT(box_co2.x, box_co2.y + brace_y, brace_w, brace_h);
+
+			EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(0, 0, 0));
+			// Graph ecg braces inside
+			DRAW_RECT(box_ecg.x + graph_border, box_ecg.y + brace_y + border, brace_w, brace_h - border * 2);
+			// Graph pleth braces inside
+			DRAW_RECT(box_pth.x + graph_border, box_pth.y + brace_y + border, brace_w, brace_h - border * 2);
+			// Graph co2 braces inside
+			DRAW_RECT(box_co2.x + graph_border, box_co2.y + brace_y + border, brace_w, brace_h - border * 2);
+
+			EVE_Cmd_wr32(s_pHalContext, COLOR_CODE_WINDOW_BAR);
+			// right menu top
+			DRAW_RECT(box_menu_top.x_end, box_menu_top.y, WINDOW_W - box_menu_top.w, box_menu_top.h);
+			// right menu bottom
+			DRAW_RECT_BORDER(box_menu_bottom.x_end, box_menu_bottom.y, WINDOW_W - box_menu_bottom.w, box_menu_bottom.h, 0x0078d7, border, 0xffffff);
+
+			// right menu HR
+			DRAW_BOX_BORDER(box_right1, 0x000000, border, 0xffffff);
+			// right menu spO2
+			DRAW_BOX_BORDER(box_right2, 0x000000, border, 0xffffff);
+			// right menu etCO2
+			DRAW_BOX_BORDER(box_right3, 0x000000, border, 0xffffff);
+			// right menu NIBP
+			DRAW_BOX_BORDER(box_right4, 0x000000, border, 0xffffff);
+			EVE_Seg_end(s_pHalContext);
+		}
+		EVE_Seg_draw(s_pHalContext, SEG_CHROME);
 
 		// buttons
 		int32_t x = box_menu_top.x;
@@ -452,6 +493,24 @@ int32_t main(int32_t argc, char *argv[])
 		EVE_CoCmd_text(s_pHalContext, app_window.x + 10, app_window.y_end - 40, 30, OPT_FORMAT, "fps = %d", getFPS());
 #endif
 
+#if ENABLE_SHOW_HAL_STATS
+		// Where the frame time went, according to the HAL counters
+		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(0, 0, 0));
+		showHalStats(s_pHalContext, app_window.x + 200, app_window.y_end - 40);
+		uint32_t graph_bytes, graph_writes;
+		graph_l1_rotate_stats(&graph_bytes, &graph_writes);
+		uint32_t overruns = 0, peak = 0;
+		data_acquire_t *acqs[] = {&acq_ecg, &acq_pleth, &acq_co2};
+		for (int32_t i = 0; i < sizeof(acqs) / sizeof(data_acquire_t *); i++)
+		{
+			uint32_t ring_overruns, ring_peak;
+			sample_ring_stats(&acqs[i]->ring, &ring_overruns, &ring_peak);
+			overruns += ring_overruns;
+			peak = max(peak, ring_peak);
+		}
+		EVE_CoCmd_text(s_pHalContext, app_window.x + 200, app_window.y_end - 56, 26, OPT_FORMAT, "graphs %u B in %u writes, rings peak %u, %u overruns", graph_bytes, graph_writes, peak, overruns);
+#endif
+
 		x = box_menu_top.x;
 		y = box_menu_top.y_mid;
 		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
@@ -498,12 +557,13 @@ int32_t main(int32_t argc, char *argv[])
 		EVE_CoCmd_button(s_pHalContext, zoombox.x, zoombox.y, zoombox.w, zoombox.h, 28, 0, "");
 		EVE_Cmd_wr32(s_pHalContext, BITMAP_HANDLE(0));
 		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(0, 0, 0));
-		EVE_CoCmd_setBitmap(s_pHalContext, zoom_out.ramg_address, COMPRESSED_RGBA_ASTC_4x4_KHR, zoom_icon_wh, zoom_icon_wh);
+		Asset_Bitmap(s_pHalContext, ASSET_ZOOM_OUT_25_WHITE);
 		EVE_Cmd_wr32(s_pHalContext, BEGIN(BITMAPS));
 		EVE_DRAW_AT(zoombox.x + zoom_icon_padding, zoombox.y_mid - zoom_icon_wh / 2); // 14 is zoom icon height / 2
-		EVE_CoCmd_setBitmap(s_pHalContext, zoom_in.ramg_address, COMPRESSED_RGBA_ASTC_4x4_KHR, zoom_icon_wh, zoom_icon_wh);
+		Asset_Bitmap(s_pHalContext, ASSET_ZOOM_IN_25_WHITE);
 		EVE_Cmd_wr32(s_pHalContext, BEGIN(BITMAPS));
 		EVE_DRAW_AT(zoombox.x_end - zoom_icon_wh - zoom_icon_padding, zoombox.y_mid - zoom_icon_wh / 2);
+		use_app_font(&font2);
 		EVE_CoCmd_text(s_pHalContext, zoombox.x_mid, zoombox.y_mid, font2.handler, OPT_FORMAT | OPT_CENTER, "%d", g_graph_zoom_lv);
 		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
 		EVE_Cmd_wr32(s_pHalContext, COLOR_A(0));
@@ -543,6 +603,7 @@ int32_t main(int32_t argc, char *argv[])
 		EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(0, 255, 0));
 		// Heart rate
 		EVE_CoCmd_text(s_pHalContext, box_right1.x + 5, box_right1.y + 5, font2.handler, 0, "HR");
+		use_app_font(&font0);
 		EVE_CoCmd_number(s_pHalContext, box_right1.x_mid, box_right1.y_mid, font0.handler, OPT_CENTER, val_hr);
 		EVE_CoCmd_text(s_pHalContext, box_right1.x_mid + 40, box_right1.y_mid, font2.handler, OPT_CENTERY, "bpm");
 
@@ -0,0 +1,143 @@
+﻿/**
+ * @file Data_Acquire.c
+ * @brief Simulated acquisition feeding one sample ring per signal
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#include "Data_Acquire.h"
+
+#if DATA_ACQUIRE_THREAD
+#include <pthread.h>
+#include <stdatomic.h>
+
+static pthread_t acquire_thread;
+static atomic_int acquire_running = 0;
+#endif
+
+static data_acquire_t *acquire_list[DATA_ACQUIRE_MAX];
+static int32_t acquire_count = 0;
+
+/**
+ * @brief Set up the acquisition of a simulated signal with an empty ring
+ *
+ * @param acq The acquisition, not started.
+ * @param signal SIGNAL_ECG, SIGNAL_PLETH or SIGNAL_CO2
+ *
+ * @return Sample rate in Hz
+ */
+int32_t data_acquire_init(data_acquire_t *acq, int32_t signal)
+{
+	acq->sample_rate = data_simulate_init(&acq->sim, signal);
+	acq->sample_frac = 0;
+	acq->time_last_ms = 0;
+	sample_ring_init(&acq->ring, acq->buffer, DATA_ACQUIRE_RING_SIZE);
+	return acq->sample_rate;
+}
+
+/**
+ * @brief Push the samples taken since the previous poll, producer side
+ *
+ * @param acq The acquisition.
+ * @param now_ms The current time in milliseconds.
+ */
+void data_acquire_poll(data_acquire_t *acq, uint32_t now_ms)
+{
+	SIGNALS_DATA_TYPE samples[64];
+	int32_t count = 0;
+
+	if (acq->time_last_ms)
+	{
+		int32_t elapsed_ms = (int32_t)min(now_ms - acq->time_last_ms, 10000);
+		int32_t due = elapsed_ms * acq->sample_rate + acq->sample_frac;
+		acq->sample_frac = due % 1000;
+		count = due / 1000;
+	}
+	acq->time_last_ms = now_ms;
+
+	while (count > 0)
+	{
+		int32_t n = data_simulate_read(&acq->sim, samples, min(count, (int32_t)(sizeof(samples) / sizeof(samples[0]))));
+		sample_ring_push(&acq->ring, samples, n); // a full ring counts the overrun and drops the rest
+		count -= n;
+	}
+}
+
+#if DATA_ACQUIRE_THREAD
+static void *acquire_thread_main(void *arg)
+{
+	(void)arg;
+	while (atomic_load(&acquire_running))
+	{
+		uint32_t now_ms = EVE_millis();
+		for (int32_t i = 0; i < acquire_count; i++)
+		{
+			data_acquire_poll(acquire_list[i], now_ms);
+		}
+		EVE_sleep(DATA_ACQUIRE_PERIOD_MS);
+	}
+	return NULL;
+}
+#endif
+
+/**
+ * @brief Start acquiring, on the acquisition thread when there is one
+ *
+ * @param acqs The acquisitions, set up with data_acquire_init.
+ * @param count The number of acquisitions, at most DATA_ACQUIRE_MAX.
+ */
+void data_acquire_start(data_acquire_t **acqs, int32_t count)
+{
+	data_acquire_stop();
+	acquire_count = min(count, DATA_ACQUIRE_MAX);
+	for (int32_t i = 0; i < acquire_count; i++)
+	{
+		acquire_list[i] = acqs[i];
+	}
+
+#if DATA_ACQUIRE_THREAD
+	atomic_store(&acquire_running, 1);
+	if (pthread_create(&acquire_thread, NULL, acquire_thread_main, NULL))
+	{
+		// no thread, data_acquire_step polls from the main loop instead
+		atomic_store(&acquire_running, 0);
+	}
+#endif
+}
+
+/**
+ * @brief Stop acquiring, the rings keep their samples
+ */
+void data_acquire_stop()
+{
+#if DATA_ACQUIRE_THREAD
+	if (atomic_exchange(&acquire_running, 0))
+	{
+		pthread_join(acquire_thread, NULL);
+	}
+#endif
+	acquire_count = 0;
+}
+
+/**
+ * @brief Poll the acquisitions from the main loop, unless the acquisition thread runs
+ */
+void data_acquire_step()
+{
+#if DATA_ACQUIRE_THREAD
+	if (atomic_load(&acquire_running))
+	{
+		return;
+	}
+#endif
+	uint32_t now_ms = EVE_millis();
+	for (int32_t i = 0; i < acquire_count; i++)
+	{
+		data_acquire_poll(acquire_list[i], now_ms);
+	}
+}
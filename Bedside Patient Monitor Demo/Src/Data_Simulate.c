@@ -1,6 +1,6 @@
 ﻿/**
  * @file Data_Simulate.c
- * @brief Functions to simulate reading data from time
+ * @brief Functions to simulate signal sources from recorded data
  *
  * @author Bridgetek
  *
@@ -11,146 +11,53 @@
  */
 
 #include "Helpers.h"
+#include "Bedside_Patient_Monitor_Demo.h"
 #include "signals_arrays.h"
 
 /**
- * @brief Simulate reading data from time
- * @param sample_rate Sample rate in Hz
- * @param time_start_ms Start time in millisecond
- * @return Number of samples
+ * @brief Start a simulated signal from its first sample
+ * @param sim The simulated signal
+ * @param signal SIGNAL_ECG, SIGNAL_PLETH or SIGNAL_CO2
+ * @return Sample rate in Hz, the recordings last 10 minutes
  */
-int read_time_simulate(int sample_rate, int time_start_ms)
+int32_t data_simulate_init(data_simulate_t *sim, int32_t signal)
 {
-	int now_ms = EVE_millis();
-	int duration_ms = now_ms - time_start_ms;
-	int num_samples = duration_ms * sample_rate / 1000;
-	// return 3;
-	return num_samples;
-}
+	const int data_duration = 10 * 60; // unit: second
 
-/**
- * @brief Simulate ECG data
- * @param data Pointer to int array to store data
- * @param data_size Pointer to int to store size of data
- * @return Pixel x coordinate
- */
-int new_data_heartbeat(SIGNALS_DATA_TYPE **data, int *data_size)
-{
-	int data_duration = 10 * 60; // unit: second
-	int dividor = 2;
-	int multipler = 3;
-	SIGNALS_DATA_TYPE *sample_buffer = ecg_data;
-	const int sample_total = sizeof(ecg_data) / sizeof(char);
-
-	static uint32_t time_start_ms = 0;
-	const int sample_per_second = sample_total / data_duration;
-	static int sample_offset = 0;
-
-	if (time_start_ms == 0)
+	if (signal == SIGNAL_PLETH)
 	{
-		time_start_ms = EVE_millis();
-		for (int i = 0; i < sample_total; i++)
-		{
-			// sample_buffer[i] = sample_buffer[i] * multipler / dividor;
-		}
+		sim->samples = ppg_data;
+		sim->sample_total = sizeof(ppg_data) / sizeof(char);
 	}
-
-	int num_samples = read_time_simulate(sample_per_second, time_start_ms);
-	if (num_samples > 0)
+	else if (signal == SIGNAL_CO2)
 	{
-		time_start_ms = EVE_millis();
-		num_samples = min(num_samples, sample_total - sample_offset);
+		sim->samples = co2_data;
+		sim->sample_total = sizeof(co2_data) / sizeof(char);
 	}
-
-	*data = &sample_buffer[sample_offset];
-	*data_size = num_samples;
-
-	// get sample (x,y) coordinate
-	int pixel_y = num_samples;
-	// int pixel_x = sample_buffer[(sample_offset + pixel_y) % sample_total] * multipler / dividor;
-	sample_offset = (sample_offset + num_samples) % sample_total;
-	return 0;
-}
-
-/**
- * @brief Simulate Plethysmography data
- * @param data Pointer to int array to store data
- * @param data_size Pointer to int to store size of data
- * @return Pixel x coordinate
- */
-int new_data_pleth(SIGNALS_DATA_TYPE **data, int *data_size)
-{
-	int data_duration = 10 * 60; // unit: second
-	int dividor = 2;
-	int multipler = 1;
-	SIGNALS_DATA_TYPE *sample_buffer = ppg_data;
-	const int sample_total = sizeof(ppg_data) / sizeof(char);
-
-	static uint32_t time_start_ms = 0;
-	const int sample_per_second = sample_total / data_duration;
-	static int sample_offset = 0;
-
-	if (time_start_ms == 0)
+	else
 	{
-		time_start_ms = EVE_millis();
-		for (int i = 0; i < sample_total; i++)
-		{
-			// sample_buffer[i] = sample_buffer[i] * multipler / dividor;
-		}
+		sim->samples = ecg_data;
+		sim->sample_total = sizeof(ecg_data) / sizeof(char);
 	}
-
-	int num_samples = read_time_simulate(sample_per_second, time_start_ms);
-	if (num_samples > 0)
-	{
-		time_start_ms = EVE_millis();
-		num_samples = min(num_samples, sample_total - sample_offset);
-	}
-
-	*data = &sample_buffer[sample_offset];
-	*data_size = num_samples;
-
-	// get sample (x,y) coordinate
-	int pixel_y = num_samples;
-	// int pixel_x = sample_buffer[(sample_offset + pixel_y) % sample_total] * multipler / dividor;
-	sample_offset = (sample_offset + num_samples) % sample_total;
-	return 0;
+	sim->sample_offset = 0;
+	return sim->sample_total / data_duration;
 }
 
 /**
- * @brief Simulate CO2 data
- * @param data Pointer to int array to store data
- * @param data_size Pointer to int to store size of data
- * @return Pixel x coordinate
+ * @brief Read the next samples of a simulated signal, looping at its end
+ * @param ctx The simulated signal, data_simulate_t
+ * @param samples Receives the samples
+ * @param count Number of samples to read
+ * @return Number of samples read
  */
-int new_data_co2(SIGNALS_DATA_TYPE **data, int *data_size)
+int32_t data_simulate_read(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count)
 {
-	int data_duration = 10 * 60; // unit: second
-	int dividor = 2;
-	int multipler = 1;
-	SIGNALS_DATA_TYPE *sample_buffer = co2_data;
-	const int sample_total = sizeof(co2_data) / sizeof(char);
+	data_simulate_t *sim = (data_simulate_t *)ctx;
 
-	static uint32_t time_start_ms = 0;
-	const int sample_per_second = sample_total / data_duration;
-	static int sample_offset = 0;
-
-	if (time_start_ms == 0)
-	{
-		time_start_ms = EVE_millis();
-	}
-
-	int num_samples = read_time_simulate(sample_per_second, time_start_ms);
-	if (num_samples > 0)
+	for (int32_t i = 0; i < count; i++)
 	{
-		time_start_ms = EVE_millis();
-		num_samples = min(num_samples, sample_total - sample_offset);
+		samples[i] = sim->samples[sim->sample_offset];
+		sim->sample_offset = (sim->sample_offset + 1) % sim->sample_total;
 	}
-
-	*data = &sample_buffer[sample_offset];
-	*data_size = num_samples;
-
-	// get sample (x,y) coordinate
-	int pixel_y = num_samples;
-	sample_offset = (sample_offset + num_samples) % sample_total;
-	return 0;
+	return count;
 }
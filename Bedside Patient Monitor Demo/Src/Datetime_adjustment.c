@@ -17,7 +17,7 @@
 #include <stdint.h>
 
 #include "Helpers.h"
-#include "common.h"
+#include "Common.h"
 #include "Bedside_Patient_Monitor_Demo.h"
 
 extern EVE_HalContext *s_pHalContext;
@@ -256,6 +256,11 @@ int32_t scrollable_list(scrolling_vertical_array_t *sc)
  */
 void dateime_adjustment(EVE_HalContext *phost)
 {
+#if defined(NULLDEV_PLATFORM)
+    /* Headless, there is no touch to confirm the dialog, keep the preset date and time */
+    return;
+#endif
+
     uint32_t dd = get_dd();
     uint32_t mm = get_mm();
     uint32_t yy = get_yyyy();
@@ -0,0 +1,172 @@
+﻿/**
+ * @file Graph_L1_raster.c
+ * @brief Span rasteriser for the 1-bpp (L1) waveform buffers
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#include <string.h>
+
+#include "Graph_L1_raster.h"
+
+/**
+ * @brief Set the pixels x0 to x1 of a L1 row, clipped to the row width
+ *
+ * L1 stores the leftmost pixel in the most significant bit of each byte, the
+ * first and last bytes of the span are masked, the bytes in between are filled.
+ *
+ * @param row The row to draw on.
+ * @param width The row width in pixels.
+ * @param x0 The first pixel of the span.
+ * @param x1 The last pixel of the span, not less than x0.
+ *
+ * @return None
+ */
+static inline void span_set(uint8_t *row, int32_t width, int32_t x0, int32_t x1)
+{
+	if (x1 < 0 || x0 >= width)
+	{
+		return;
+	}
+	if (x0 < 0)
+	{
+		x0 = 0;
+	}
+	if (x1 >= width)
+	{
+		x1 = width - 1;
+	}
+
+	int32_t b0 = x0 >> 3;
+	int32_t b1 = x1 >> 3;
+	uint8_t m0 = (uint8_t)(0xFF >> (x0 & 7));
+	uint8_t m1 = (uint8_t)(0xFF << (7 - (x1 & 7)));
+
+	if (b0 == b1)
+	{
+		row[b0] |= m0 & m1;
+		return;
+	}
+	row[b0] |= m0;
+	while (++b0 < b1)
+	{
+		row[b0] = 0xFF; // spans are short, a loop beats a memset call
+	}
+	row[b1] |= m1;
+}
+
+void graph_raster_span(uint8_t *row, int32_t width, int32_t x0, int32_t x1)
+{
+	span_set(row, width, x0, x1);
+}
+
+/**
+ * @brief Draw the segment between two samples over a number of rows
+ *
+ * Row 0 starts at the previous sample x_from, the last row ends at the new
+ * sample x_to. Each row covers the part of the segment within half a row of
+ * its centre, so the spans of consecutive rows touch and the trace has no gaps.
+ * The rows are cleared first.
+ *
+ * @param rows The first row to draw on.
+ * @param stride The bytes per row.
+ * @param row_count The number of rows the segment spans, at least 1.
+ * @param width The row width in pixels.
+ * @param x_from The x-coordinate of the previous sample.
+ * @param x_to The x-coordinate of the new sample.
+ *
+ * @return None
+ */
+void graph_raster_segment(uint8_t *rows, int32_t stride, int32_t row_count, int32_t width, int32_t x_from, int32_t x_to)
+{
+	memset(rows, 0, stride * row_count);
+
+	// walk from the left end, upwards in rows when the trace falls to the left
+	int32_t x = x_from;
+	int32_t adx = x_to - x_from;
+	uint8_t *row = rows;
+	int32_t row_step = stride;
+	if (adx < 0)
+	{
+		x = x_to;
+		adx = -adx;
+		row = rows + (row_count - 1) * stride;
+		row_step = -stride;
+	}
+
+	if (row_count == 1)
+	{
+		span_set(row, width, x, x + adx);
+		return;
+	}
+
+	// right end of each row, x + adx * (2 * r + 1) / steps2 rounded, stepped without divisions
+	int32_t steps2 = 2 * (row_count - 1); // half rows from the first to the last row centre
+	int32_t step = (2 * adx) / steps2;
+	int32_t step_rem = (2 * adx) % steps2;
+	int32_t xb = x + (adx + row_count - 1) / steps2;
+	int32_t xb_rem = (adx + row_count - 1) % steps2;
+	int32_t x_end = x + adx;
+
+	if (x < 0 || x_end >= width)
+	{
+		// partly outside the row, rare, clip each span
+		for (int32_t r = 0; r < row_count - 1; r++)
+		{
+			span_set(row, width, x, xb);
+			row += row_step;
+			x = xb;
+			xb += step;
+			xb_rem += step_rem;
+			if (xb_rem >= steps2)
+			{
+				xb++;
+				xb_rem -= steps2;
+			}
+		}
+		span_set(row, width, x, x_end);
+		return;
+	}
+
+	for (int32_t r = 0; r < row_count; r++)
+	{
+		if (r == row_count - 1)
+		{
+			xb = x_end;
+		}
+
+		// mask the first and last byte of the span, fill the bytes in between
+		int32_t b0 = x >> 3;
+		int32_t b1 = xb >> 3;
+		uint8_t m0 = (uint8_t)(0xFF >> (x & 7));
+		uint8_t m1 = (uint8_t)(0xFF << (7 - (xb & 7)));
+
+		if (b0 == b1)
+		{
+			row[b0] |= m0 & m1;
+		}
+		else
+		{
+			row[b0] |= m0;
+			while (++b0 < b1)
+			{
+				row[b0] = 0xFF;
+			}
+			row[b1] |= m1;
+		}
+		row += row_step;
+		x = xb;
+		xb += step;
+		xb_rem += step_rem;
+		if (xb_rem >= steps2)
+		{
+			xb++;
+			xb_rem -= steps2;
+		}
+	}
+}
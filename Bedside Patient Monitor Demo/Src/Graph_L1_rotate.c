@@ -10,131 +10,43 @@
  * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
  */
 
-#include "Helpers.h"
-#include "Bedside_Patient_Monitor_Demo.h"
+#include "Graph_L1_rotate.h"
+#include "Graph_L1_raster.h"
 
 extern EVE_HalContext s_halContext;
 extern EVE_HalContext *s_pHalContext;
 
-int32_t new_data_heartbeat(int **data, int *data_size);
-int32_t new_data_pleth(int **data, int *data_size);
-int32_t new_data_co2(int **data, int *data_size);
-
 #define GRAPH_BIT_PER_PIXEL 1												  // l1 1 bit per pixel
 #define GRAPH_BIT_PER_LINE (GRAPH_BIT_PER_PIXEL * GRAPH_W)					  // bbp * width // 160
 #define GRAPH_BYTE_PER_LINE (GRAPH_BIT_PER_LINE / BIT_PER_CHAR)				  // 160 / 8
 #define GRAPH_BYTE_PER_BUFFER (GRAPH_H * (GRAPH_BIT_PER_LINE / BIT_PER_CHAR)) // 160 / 8 * 1000
-#define GRAPH_BUFFER_NUM 3													  // display from buffer 1, append to buffer 2, loopback to buffer 0
-#define GRAPH_BUFFER_SIZE (GRAPH_BYTE_PER_BUFFER * GRAPH_BUFFER_NUM)
+#define GRAPH_FRAME_MAX_LINES 64											  // lines appended to a channel per frame, at most
+#define GRAPH_RING_SLACK_LINES (GRAPH_FRAME_MAX_LINES * (EVE_CMD_FRAMES_IN_FLIGHT + 1)) // lines written ahead of the history while the frames in flight and the frame on screen still read it
+#define GRAPH_BUFFER_SIZE (GRAPH_BYTE_PER_BUFFER + GRAPH_RING_SLACK_LINES * GRAPH_BYTE_PER_LINE) // ring of 1 buffer
 
-typedef struct
+struct wave_channel
 {
-	int32_t handler;
-	int32_t bitmap_rp;				   // bitmap read pointer, use buffer 0 and 1
-	int32_t bitmap_wp;				   // bitmap write pointer, use buffer 1 and 2
-	int32_t bitmap_wplb;			   // bitmap write pointer loopback, use buffer 0
-	int32_t buffer0, buffer1, buffer2; // 3 buffer on ramg
-	int32_t loopback_addr;
-	int32_t buffer2_end; // end addreff of buffer 2
+	int32_t bitmap_rp;	// bitmap read pointer, GRAPH_H lines behind the write pointer in the ring
+	int32_t bitmap_wp;	// bitmap write pointer
+	int32_t ring_start; // ring on ramg, allocated with EVE_RamG_alloc
+	int32_t ring_end;	// end address of the ring
 	int32_t x, y, w, h;
 	uint32_t rgba;
 	int32_t x_graph_last;
-} app_graph_t;
-
-static app_graph_t graph_heartbeat;
-static app_graph_t graph_pleth;
-static app_graph_t graph_co2;
-
-/**
- * @brief Set a pixel color on/off in a graph buffer according to input coordinates and color.
- *
- * @param buffer The graph buffer to draw on.
- * @param x The x-coordinate of the pixel to draw.
- * @param y The y-coordinate of the pixel to draw.
- * @param rgba The color of the pixel. Non-zero values set the pixel color to on.
- *
- * @return None
- */
-static void draw_pixel(SIGNALS_DATA_TYPE *buffer, int32_t x, int32_t y, uint32_t rgba)
-{
-	if (y > GRAPH_H * 2)
-	{
-		goto err;
-	}
-
-	if (x < 0)
-	{
-		goto err;
-	}
-	if (x < 0 || x >= GRAPH_W)
-	{
-		goto err;
-	}
-
-	// set pixel color on/off
-	int32_t pixel_nth = x + y * GRAPH_W;
-	int32_t byte_index = pixel_nth / 8;	   // byte nth
-	int32_t bit_index = 7 - pixel_nth % 8; // bit nth
-
-	if (byte_index >= GRAPH_BYTE_PER_LINE * g_graph_zoom_lv)
-	{
-		goto err;
-	}
-
-	buffer[byte_index] |= (1 << bit_index);
-	return;
-
-err:
-	printf("Skip a pixel at (%d, %d)\n", x, y);
-	return;
-}
-
-/**
- * @brief Draws a line on the given buffer using Bresenham's line drawing algorithm
- *
- * @param buffer The buffer to draw the line on.
- * @param x1 The x-coordinate of the starting pixel.
- * @param y1 The y-coordinate of the starting pixel.
- * @param x2 The x-coordinate of the ending pixel.
- * @param y2 The y-coordinate of the ending pixel.
- * @param rgba The color of the line.
- *
- * @return None
- */
-static void bresenham_line(SIGNALS_DATA_TYPE *buffer, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t rgba)
-{
-	int32_t dx = abs(x2 - x1);
-	int32_t dy = abs(y2 - y1);
-	int32_t sx = (x2 > x1) ? 1 : -1;
-	int32_t sy = (y2 > y1) ? 1 : -1;
-	int32_t err = dx - dy;
-
-	while (1)
-	{
-		// Draw the current pixel
-		draw_pixel(buffer, x1, y1, rgba);
-
-		// Check if the endpoint is reached
-		if (x1 == x2 && y1 == y2)
-		{
-			break;
-		}
-
-		int32_t e2 = 2 * err;
-
-		// Adjust error and coordinates
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x1 += sx;
-		}
-		if (e2 < dx)
-		{
-			err += dx;
-			y1 += sy;
-		}
-	}
-}
+	int32_t sample_rate; // samples per second
+	int32_t sample_frac; // part of a sample due, in 1/1000 samples
+	uint32_t time_last_ms;
+	wave_range_t range;
+	wave_source_t source;
+	void *source_ctx;
+};
+
+static wave_channel_t wave_channels[WAVE_CHANNEL_MAX];
+static int32_t wave_channel_count = 0;
+static SIGNALS_DATA_TYPE wave_samples[GRAPH_H];	  // new samples of one channel
+static uint8_t graph_rows[GRAPH_BYTE_PER_BUFFER]; // rows of the new samples of one channel, written to RAM_G at once
+static uint32_t graph_frame_bytes = 0;			  // bytes written to RAM_G for the graphs, this frame
+static uint32_t graph_frame_writes = 0;			  // RAM_G writes for the graphs, this frame
 
 /**
  * @brief Normalizes a sensor value to fit within the graph's y-axis range
@@ -146,7 +58,7 @@ static void bresenham_line(SIGNALS_DATA_TYPE *buffer, int32_t x1, int32_t y1, in
  *
  * @return The normalized value in the range [graph_min, graph_max]
  */
-static int32_t normalize_to_graph(app_graph_t *graph, int32_t sensor_value, int32_t sensor_min, int32_t sensor_max)
+static int32_t normalize_to_graph(wave_channel_t *graph, int32_t sensor_value, int32_t sensor_min, int32_t sensor_max)
 {
 #define graph_max graph->h
 #define graph_min 1
@@ -169,27 +81,56 @@ static int32_t normalize_to_graph(app_graph_t *graph, int32_t sensor_value, int3
 }
 
 /**
- * @brief Appends a new graph line to the current graph.
+ * @brief Appends new graph lines to the current graph.
+ *
+ * All the lines are rasterised into one host buffer, then written to RAM_G
+ * with a single vectored write, split in two where the ring wraps.
  *
  * @param graph The graph to append to.
  * @param lines The new line data to append, where each element is a byte representing a y-axis value.
  * @param line_count The number of elements in lines.
  *
  */
-static void graph_append(app_graph_t *graph, SIGNALS_DATA_TYPE *lines, int32_t line_count)
+static void graph_append(wave_channel_t *graph, SIGNALS_DATA_TYPE *lines, int32_t line_count)
 {
-	uint8_t buffer_1line[GRAPH_BYTE_PER_LINE * GRAPH_ZOOM_LV_MAX] = {{0}};
-	uint32_t addr = graph->bitmap_wp;
+	int32_t line_bytes = GRAPH_BYTE_PER_LINE * g_graph_zoom_lv;
+	uint8_t *row = graph_rows;
 	for (int32_t i = 0; i < line_count; i++)
 	{
-		memset(buffer_1line, 0, sizeof(buffer_1line));
 		SIGNALS_DATA_TYPE x = lines[i] & 0xFF;
-		x = normalize_to_graph(graph, x, 0, 255);
-		bresenham_line(buffer_1line, x, g_graph_zoom_lv - 1, graph->x_graph_last, 0, graph->rgba);
+		x = normalize_to_graph(graph, x, graph->range.min, graph->range.max);
+		graph_raster_segment(row, GRAPH_BYTE_PER_LINE, g_graph_zoom_lv, GRAPH_W, graph->x_graph_last, x);
 		graph->x_graph_last = x;
-		EVE_Hal_wrMem(s_pHalContext, addr, buffer_1line, GRAPH_BYTE_PER_LINE * g_graph_zoom_lv);
-		addr += GRAPH_BYTE_PER_LINE * g_graph_zoom_lv;
+		row += line_bytes;
 	}
+	// one write, with a second vector when the rows wrap around the end of the ring
+	int32_t bytes_count = line_count * line_bytes;
+	int32_t bytes_first = min(bytes_count, graph->ring_end - graph->bitmap_wp);
+	EVE_IoVec v[2] = {
+		{ graph->bitmap_wp, graph_rows, bytes_first },
+		{ graph->ring_start, graph_rows + bytes_first, bytes_count - bytes_first },
+	};
+	EVE_Hal_wrv(s_pHalContext, v, bytes_count > bytes_first ? 2 : 1);
+	graph_frame_writes++;
+	graph_frame_bytes += bytes_count;
+}
+
+/**
+ * @brief Sets up the bitmap of a slice of the visible lines of a graph
+ *
+ * @param addr The RAM_G address of the first line of the slice
+ * @param lines The number of lines in the slice
+ * @param graph_w The graph width, in lines
+ */
+static void graph_slice(int32_t addr, int32_t lines, int32_t graph_w)
+{
+	int32_t lw = max(graph_w, GRAPH_W);
+	int32_t lh = max(graph_w, GRAPH_W);
+
+	// BORDER keeps the area past the last line of the slice transparent
+	EVE_CoCmd_setBitmap(s_pHalContext, addr, L1, GRAPH_W, lines);
+	EVE_Cmd_wr32(s_pHalContext, BITMAP_SIZE(NEAREST, BORDER, BORDER, lw, lh));
+	EVE_Cmd_wr32(s_pHalContext, BITMAP_SIZE_H(lw >> 9, lh >> 9));
 }
 
 /**
@@ -200,23 +141,21 @@ static void graph_append(app_graph_t *graph, SIGNALS_DATA_TYPE *lines, int32_t l
  * This function displays a graph on the screen, with the graph's bitmap as the
  * background and the graph's color as the foreground. The graph's bitmap is
  * rotated by 90 degrees to fit the screen vertically. The graph's color is
- * extracted from the rgba field of the graph struct.
+ * extracted from the rgba field of the graph struct. When the visible lines
+ * wrap around the end of the ring, the lines from the start of the ring are
+ * drawn as a second bitmap slice right after the first.
  */
-static void graph_display(app_graph_t *graph)
+static void graph_display(wave_channel_t *graph)
 {
-	int32_t bformat = L1;
-	int32_t lw = max(graph->w, GRAPH_W);
-	int32_t lh = max(graph->w, GRAPH_W);
+	int32_t lines_first = min(graph->w, (graph->ring_end - graph->bitmap_rp) / (int32_t)GRAPH_BYTE_PER_LINE);
 #define MAX_ANGLE 360
 #define MAX_CIRCLE_UNIT 65536
 	int32_t rotation_angle = -90;
 
 	// display bitmap
 	EVE_Cmd_wr32(s_pHalContext, COLOR_RGB(255, 255, 255));
-	EVE_CoCmd_setBitmap(s_pHalContext, graph->bitmap_rp, bformat, GRAPH_W, graph->w);
+	graph_slice(graph->bitmap_rp, lines_first, graph->w);
 	EVE_Cmd_wr32(s_pHalContext, PALETTE_SOURCE(0));
-	EVE_Cmd_wr32(s_pHalContext, BITMAP_SIZE(NEAREST, BORDER, BORDER, lw, lh));
-	EVE_Cmd_wr32(s_pHalContext, BITMAP_SIZE_H(lw >> 9, lh >> 9));
 	EVE_Cmd_wr32(s_pHalContext, SAVE_CONTEXT());
 	EVE_CoCmd_loadIdentity(s_pHalContext);
 	EVE_CoCmd_translate(s_pHalContext, 0, GRAPH_W * MAX_CIRCLE_UNIT);
@@ -235,6 +174,12 @@ static void graph_display(app_graph_t *graph)
 	int32_t x = graph->x;
 	int32_t y = graph->y - (GRAPH_W - graph->h);
 	EVE_DRAW_AT(x, y);
+	if (lines_first < graph->w)
+	{
+		// line n of the bitmap is drawn at x + n, the rotation keeps the transform of the first slice
+		graph_slice(graph->ring_start, graph->w - lines_first, graph->w);
+		EVE_DRAW_AT(x + lines_first, y);
+	}
 	EVE_Cmd_wr32(s_pHalContext, RESTORE_CONTEXT());
 }
 
@@ -249,122 +194,167 @@ static void graph_display(app_graph_t *graph)
  * @param line_count The number of elements in lines.
  *
  */
-static void graph_append_and_display(app_graph_t *graph, SIGNALS_DATA_TYPE *lines, int32_t line_count)
+static void graph_append_and_display(wave_channel_t *graph, SIGNALS_DATA_TYPE *lines, int32_t line_count)
 {
-	// skip overflow lines
-	if (line_count > min(line_count, graph->w / g_graph_zoom_lv))
-	{
-		return;
-	}
-
 	// write data to ramg
-	while (btnStartState == BTN_START_INACTIVE)
+	if (line_count > 0 && btnStartState == BTN_START_INACTIVE)
 	{
+		int32_t ring_size = graph->ring_end - graph->ring_start;
 		int32_t bytes_count = line_count * g_graph_zoom_lv * GRAPH_BYTE_PER_LINE;
 
-		// if data size >= buffer2, write to buffer0
-		if (graph->bitmap_wp + bytes_count >= graph->buffer2_end)
-		{
-			graph->bitmap_wp = graph->bitmap_wplb;
-			graph_append(graph, lines, line_count);
-			graph->bitmap_wplb = graph->buffer0;
-			graph->bitmap_wp += bytes_count;
-			graph->bitmap_rp = graph->bitmap_wp - GRAPH_BYTE_PER_BUFFER;
-			break;
-		}
-
 		graph_append(graph, lines, line_count);
 
-		// loopback
-		if (graph->bitmap_wp + bytes_count > graph->loopback_addr)
+		// advance both pointers around the ring
+		graph->bitmap_wp += bytes_count;
+		if (graph->bitmap_wp >= graph->ring_end)
 		{
-			EVE_CoCmd_memCpy(s_pHalContext, graph->bitmap_wplb, graph->bitmap_wp, bytes_count);
-			graph->bitmap_wplb += bytes_count;
+			graph->bitmap_wp -= ring_size;
 		}
-
-		// increase write pointer
 		graph->bitmap_rp += bytes_count;
-		graph->bitmap_wp += bytes_count;
-		break;
+		if (graph->bitmap_rp >= graph->ring_end)
+		{
+			graph->bitmap_rp -= ring_size;
+		}
 	}
 
 	graph_display(graph);
 }
 
 /**
- * @brief Initializes the graph buffers and settings for each graph type (heartbeat, pleth, CO2).
- *
- * This function sets up three graph structures for displaying different types of data: heartbeat, pleth, and CO2.
- * Each graph is initialized with separate buffers, memory addresses, and display parameters. The function also
- * clears the memory for each graph buffer and assigns specific colors to each graph type.
+ * @brief Removes all the waveform channels and frees their RAM_G.
+ */
+void graph_l1_rotate_init()
+{
+	for (int32_t i = 0; i < wave_channel_count; i++)
+	{
+		EVE_RamG_free(s_pHalContext, wave_channels[i].ring_start);
+	}
+	memset(wave_channels, 0, sizeof(wave_channels));
+	wave_channel_count = 0;
+}
+
+/**
+ * @brief Registers a waveform channel and allocates its RAM_G ring.
  *
- * @param box_heartbeat Pointer to the app_box structure defining the display area for the heartbeat graph.
- * @param box_pleth Pointer to the app_box structure defining the display area for the pleth graph.
- * @param box_co2 Pointer to the app_box structure defining the display area for the CO2 graph.
+ * @param box The display area of the channel.
+ * @param colour The trace colour, 0xRRGGBBAA.
+ * @param sample_rate The samples per second taken from the channel source, 0 to take
+ *                    all the samples the source has, for sources paced by their producer.
+ * @param range The sample values drawn at the bottom and the top of the box.
  *
- * @return The ending address of the buffer for the CO2 graph, indicating the total memory used by all graph buffers.
+ * @return The channel, NULL if WAVE_CHANNEL_MAX channels exist or RAM_G is full.
  */
-uint32_t graph_l1_rotate_init(app_box *box_heartbeat, app_box *box_pleth, app_box *box_co2)
+wave_channel_t *wave_channel_create(app_box *box, uint32_t colour, int32_t sample_rate, wave_range_t range)
 {
-	//      ramg: <-------- read pointer -------->lb<- when write pointer reached here, start loopback to buffer 0
-	//      ramg: -------------------------------------------------
-	//      ramg: |   buffer 0    |   buffer 1    |   buffer 2    |
-	//      ramg: -------------------------------------------------
-	//      ramg:                 <-------- write pointer -------->
+	//      ramg: ---------------------------------------------------
+	//      ramg: | ... slice 2 | slack |  slice 1  ... GRAPH_H lines |
+	//      ramg: ---------------------------------------------------
+	//      ramg:               ^ write pointer ^ read pointer, the visible lines wrap to the ring start
 
-	memset(&graph_heartbeat, 0, sizeof(app_graph_t));
-	memset(&graph_pleth, 0, sizeof(app_graph_t));
-	memset(&graph_co2, 0, sizeof(app_graph_t));
+	if (wave_channel_count >= WAVE_CHANNEL_MAX)
+	{
+		return NULL;
+	}
+	uint32_t ring = EVE_RamG_alloc(s_pHalContext, GRAPH_BUFFER_SIZE, EVE_RAMG_ALIGN_DEFAULT);
+	if (ring == EVE_RAMG_NULL)
+	{
+		return NULL;
+	}
 
-	app_graph_t *graphs[] = {&graph_heartbeat, &graph_pleth, &graph_co2};
-	app_box *boxs[] = {box_heartbeat, box_pleth, box_co2};
-	int32_t colors[] = {0x00ff0000, 0x00ffff00, 0xffff0000};
+	wave_channel_t *gh = &wave_channels[wave_channel_count++];
+	memset(gh, 0, sizeof(wave_channel_t));
+	gh->ring_start = ring;
+	gh->ring_end = gh->ring_start + GRAPH_BUFFER_SIZE;
+
+	gh->bitmap_rp = gh->ring_start;							// display from the ring start
+	gh->bitmap_wp = gh->ring_start + GRAPH_BYTE_PER_BUFFER; // append GRAPH_H lines ahead
+	gh->x = box->x;
+	gh->y = box->y;
+	gh->w = box->w;
+	gh->h = box->h;
+	gh->rgba = colour;
+	gh->sample_rate = sample_rate;
+	gh->range = range;
+	EVE_CoCmd_memSet(s_pHalContext, gh->ring_start, 0, GRAPH_BUFFER_SIZE);
+	return gh;
+}
 
-	for (int32_t i = 0; i < 3; i++)
+/**
+ * @brief Sets where a channel takes its samples from.
+ *
+ * @param channel The channel.
+ * @param source Called once per frame with the number of samples due.
+ * @param ctx Passed to source.
+ */
+void wave_channel_source(wave_channel_t *channel, wave_source_t source, void *ctx)
+{
+	channel->source = source;
+	channel->source_ctx = ctx;
+}
+
+/**
+ * @brief Collects the new samples of every channel and draws the channels.
+ *
+ * The samples due since the previous call follow from the sample rate of each
+ * channel, channels without a rate drain their source. The channels are processed one after the other through the same
+ * sample and row buffers, so the host cost grows linearly with the channels.
+ *
+ * @param now_ms The current time in milliseconds.
+ */
+void wave_channel_draw_all(uint32_t now_ms)
+{
+	graph_frame_bytes = 0;
+	graph_frame_writes = 0;
+
+	for (int32_t i = 0; i < wave_channel_count; i++)
 	{
-		app_graph_t *gh = graphs[i];
-		gh->buffer0 = i * GRAPH_BUFFER_SIZE; // loopback buffer
-		gh->buffer1 = gh->buffer0 + GRAPH_BYTE_PER_BUFFER;
-		gh->buffer2 = gh->buffer1 + GRAPH_BYTE_PER_BUFFER;
+		wave_channel_t *ch = &wave_channels[i];
+		int32_t count = 0;
 
-		gh->loopback_addr = gh->buffer2;
-		gh->buffer2_end = gh->buffer2 + GRAPH_BYTE_PER_BUFFER;
+		if (!ch->sample_rate)
+		{
+			count = GRAPH_H; // drained, the source returns the samples it has
+		}
+		else if (ch->time_last_ms)
+		{
+			int32_t elapsed_ms = (int32_t)min(now_ms - ch->time_last_ms, 10000); // a longer pause is dropped anyway
+			int32_t due = elapsed_ms * ch->sample_rate + ch->sample_frac;
+			ch->sample_frac = due % 1000;
+			count = due / 1000;
+		}
+		ch->time_last_ms = now_ms;
 
-		gh->bitmap_rp = gh->buffer0;   // display from buffer 0 and continue to buffer 1
-		gh->bitmap_wp = gh->buffer1;   // append to buffer 1 and continue to buffer 2
-		gh->bitmap_wplb = gh->buffer0; // loopback from buffer 0
-		gh->x = boxs[i]->x;
-		gh->y = boxs[i]->y;
-		gh->w = boxs[i]->w;
-		gh->h = boxs[i]->h;
-		gh->handler = i + 1;
-		gh->rgba = colors[i];
-		EVE_CoCmd_memSet(s_pHalContext, gh->buffer0, 0, GRAPH_BUFFER_SIZE);
+		// at most GRAPH_FRAME_MAX_LINES lines, so the ring slack covers the frames still reading it,
+		// older samples are dropped, a drained source keeps them for the next frames
+		count = min(count, min(min(ch->w, GRAPH_H), GRAPH_FRAME_MAX_LINES) / g_graph_zoom_lv);
+		if (count > 0 && ch->source)
+		{
+			count = ch->source(ch->source_ctx, wave_samples, count);
+		}
+		else
+		{
+			count = 0;
+		}
+		graph_append_and_display(ch, wave_samples, count);
 	}
-	return graph_co2.buffer2_end;
 }
 
 /**
- * @brief Collects new data samples for each graph type and updates their display.
- *
- * This function retrieves new data samples for the heartbeat, plethysmography, and CO2 graphs
- * by calling their respective data simulation functions. It then appends these data samples
- * to each graph and updates their display on the screen.
+ * @brief Collects new data samples for each channel and updates their display.
  */
 void graph_l1_rotate_draw()
 {
-	SIGNALS_DATA_TYPE *data_heartbeat;
-	SIGNALS_DATA_TYPE *data_pleth;
-	SIGNALS_DATA_TYPE *data_co2;
-	int32_t data_heartbeat_size = 0;
-	int32_t data_pleth_size = 0;
-	int32_t data_co2_size = 0;
-
-	int32_t x1 = new_data_heartbeat(&data_heartbeat, &data_heartbeat_size);
-	int32_t x2 = new_data_pleth(&data_pleth, &data_pleth_size);
-	int32_t x3 = new_data_co2(&data_co2, &data_co2_size);
+	wave_channel_draw_all(EVE_millis());
+}
 
-	graph_append_and_display(&graph_heartbeat, data_heartbeat, data_heartbeat_size);
-	graph_append_and_display(&graph_pleth, data_pleth, data_pleth_size);
-	graph_append_and_display(&graph_co2, data_co2, data_co2_size);
-}
\ No newline at end of file
+/**
+ * @brief Reports the RAM_G traffic of the channels during the last graph_l1_rotate_draw.
+ *
+ * @param bytes Receives the bytes written by the host.
+ * @param writes Receives the number of host writes.
+ */
+void graph_l1_rotate_stats(uint32_t *bytes, uint32_t *writes)
+{
+	*bytes = graph_frame_bytes;
+	*writes = graph_frame_writes;
+}
@@ -58,6 +58,38 @@ int32_t getFPS()
 	return fps;
 }
 
+/**
+ * @brief Draw the HAL performance counters of the previous frame
+ *
+ * @details Takes a snapshot of the HAL counters and resets them, so this must
+ * be called exactly once per frame. The frame time is split into the time
+ * blocked on the coprocessor and media FIFO, and the remainder, which is
+ * spent on the host CPU and the bus.
+ *
+ * @param phost Pointer to Hal context
+ * @param x X position of the overlay
+ * @param y Y position of the overlay
+ */
+void showHalStats(EVE_HalContext *phost, int16_t x, int16_t y)
+{
+	EVE_HalStats stats;
+	uint32_t waitMillis;
+
+	EVE_Hal_statsSnapshot(phost, &stats);
+	EVE_Hal_statsReset(phost);
+	waitMillis = stats.WaitFlushMillis + stats.WaitSpaceMillis + stats.WaitMediaFifoMillis;
+
+	EVE_CoCmd_text(phost, x, y, 26, OPT_FORMAT, "frame %u ms, host %u ms, flush %u ms, space %u ms, media %u ms",
+	    stats.Millis, stats.Millis - min(stats.Millis, waitMillis),
+	    stats.WaitFlushMillis, stats.WaitSpaceMillis, stats.WaitMediaFifoMillis);
+	EVE_CoCmd_text(phost, x, y + 16, 26, OPT_FORMAT, "%u transfers, %u B written, %u B read, %u cmd words, %u dl words filtered, %u faults",
+	    stats.Transfers, stats.BytesWritten, stats.BytesRead, stats.CmdBytes >> 2, stats.DlWordsFiltered, stats.CmdFaults);
+
+	const FontCache_Stats_t *fc = FontCache_Get_Stats();
+	EVE_CoCmd_text(phost, x, y + 32, 26, OPT_FORMAT, "font cache %u B, %u of %u glyphs used, %u misses, %u of %u samples full",
+	    fc->size, fc->used, fc->total, fc->misses, fc->full, fc->samples);
+}
+
 // Static variables to store initial date-time
 static int init_dd = 0, init_mm = 0, init_yyyy = 0;
 static int init_hh = 0, init_m = 0, init_ss = 0, init_ms = 0, init_eve_millis = 0;
@@ -0,0 +1,179 @@
+﻿/**
+ * @file Sample_Ring.c
+ * @brief Lock-free single producer, single consumer ring of waveform samples
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ */
+
+#include <string.h>
+
+#include "Sample_Ring.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+// __iso_volatile keeps the plain access whatever /volatile is set to, the fence gives the ordering
+#if defined(_M_ARM64)
+#define RING_FENCE() __dmb(_ARM64_BARRIER_ISH)
+#elif defined(_M_ARM)
+#define RING_FENCE() __dmb(_ARM_BARRIER_ISH)
+#elif defined(_M_IX86) || defined(_M_X64)
+#define RING_FENCE() _ReadWriteBarrier() // x86 and x64 do not reorder loads with loads nor stores with stores
+#else
+#error "Sample_Ring.c has no acquire and release for this MSVC target"
+#endif
+
+static inline uint32_t ring_load_relaxed(sample_ring_index_t *index)
+{
+	return (uint32_t)__iso_volatile_load32((volatile __int32 *)index);
+}
+
+static inline uint32_t ring_load_acquire(sample_ring_index_t *index)
+{
+	uint32_t value = (uint32_t)__iso_volatile_load32((volatile __int32 *)index);
+	RING_FENCE();
+	return value;
+}
+
+static inline void ring_store_release(sample_ring_index_t *index, uint32_t value)
+{
+	RING_FENCE();
+	__iso_volatile_store32((volatile __int32 *)index, (__int32)value);
+}
+#else
+static inline uint32_t ring_load_relaxed(sample_ring_index_t *index)
+{
+	return atomic_load_explicit(index, memory_order_relaxed);
+}
+
+static inline uint32_t ring_load_acquire(sample_ring_index_t *index)
+{
+	return atomic_load_explicit(index, memory_order_acquire);
+}
+
+static inline void ring_store_release(sample_ring_index_t *index, uint32_t value)
+{
+	atomic_store_explicit(index, value, memory_order_release);
+}
+#endif
+
+/**
+ * @brief Set up an empty ring over a sample buffer
+ *
+ * @param ring The ring.
+ * @param buffer The sample storage, owned by the caller.
+ * @param size The number of samples in buffer, a power of 2.
+ *
+ * @return 1 on success, 0 if size is not a power of 2
+ */
+int32_t sample_ring_init(sample_ring_t *ring, SIGNALS_DATA_TYPE *buffer, uint32_t size)
+{
+	if (!size || (size & (size - 1)))
+	{
+		return 0;
+	}
+	memset(ring, 0, sizeof(sample_ring_t));
+	ring->buffer = buffer;
+	ring->mask = size - 1;
+	return 1;
+}
+
+/**
+ * @brief Append samples to the ring, producer side only
+ *
+ * The samples which do not fit are dropped and added to the overrun count,
+ * the samples already waiting are kept.
+ *
+ * @param ring The ring.
+ * @param samples The new samples.
+ * @param count The number of new samples.
+ *
+ * @return The number of samples appended
+ */
+int32_t sample_ring_push(sample_ring_t *ring, const SIGNALS_DATA_TYPE *samples, int32_t count)
+{
+	uint32_t head = ring_load_relaxed(&ring->head);
+	uint32_t tail = ring_load_acquire(&ring->tail); // the consumer is done with the samples before tail
+	uint32_t level = head - tail;
+	uint32_t space = ring->mask + 1 - level;
+	uint32_t n = min((uint32_t)count, space);
+	uint32_t offset = head & ring->mask;
+	uint32_t first = min(n, ring->mask + 1 - offset);
+
+	memcpy(ring->buffer + offset, samples, first * sizeof(SIGNALS_DATA_TYPE));
+	memcpy(ring->buffer, samples + first, (n - first) * sizeof(SIGNALS_DATA_TYPE));
+	ring_store_release(&ring->head, head + n); // publish the samples
+
+	if (n < (uint32_t)count)
+	{
+		ring_store_release(&ring->overruns, ring_load_relaxed(&ring->overruns) + (uint32_t)count - n);
+	}
+	if (level + n > ring_load_relaxed(&ring->peak))
+	{
+		ring_store_release(&ring->peak, level + n);
+	}
+	return (int32_t)n;
+}
+
+/**
+ * @brief Take the oldest samples from the ring, consumer side only
+ *
+ * @param ring The ring.
+ * @param samples Receives the samples.
+ * @param count The most samples to take.
+ *
+ * @return The number of samples taken, less than count when the ring runs empty
+ */
+int32_t sample_ring_pop(sample_ring_t *ring, SIGNALS_DATA_TYPE *samples, int32_t count)
+{
+	uint32_t tail = ring_load_relaxed(&ring->tail);
+	uint32_t head = ring_load_acquire(&ring->head); // the samples before head are written
+	uint32_t n = min((uint32_t)count, head - tail);
+	uint32_t offset = tail & ring->mask;
+	uint32_t first = min(n, ring->mask + 1 - offset);
+
+	memcpy(samples, ring->buffer + offset, first * sizeof(SIGNALS_DATA_TYPE));
+	memcpy(samples + first, ring->buffer, (n - first) * sizeof(SIGNALS_DATA_TYPE));
+	ring_store_release(&ring->tail, tail + n); // hand the space back to the producer
+	return (int32_t)n;
+}
+
+/**
+ * @brief The number of samples waiting, exact on the consumer side
+ */
+uint32_t sample_ring_level(sample_ring_t *ring)
+{
+	return ring_load_acquire(&ring->head) - ring_load_acquire(&ring->tail);
+}
+
+/**
+ * @brief Read the overrun counters, from either side
+ *
+ * @param ring The ring.
+ * @param overruns Receives the samples dropped because the ring was full.
+ * @param peak Receives the most samples which were waiting at once.
+ */
+void sample_ring_stats(sample_ring_t *ring, uint32_t *overruns, uint32_t *peak)
+{
+	*overruns = ring_load_acquire(&ring->overruns);
+	*peak = ring_load_acquire(&ring->peak);
+}
+
+/**
+ * @brief Channel source draining a ring, see wave_source_t
+ *
+ * @param ctx The ring, sample_ring_t.
+ * @param samples Receives the samples.
+ * @param count The most samples to take.
+ *
+ * @return The number of samples taken
+ */
+int32_t sample_ring_read(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count)
+{
+	return sample_ring_pop((sample_ring_t *)ctx, samples, count);
+}
@@ -0,0 +1,191 @@
+﻿/**
+ * @file Graph_Bench.c
+ * @brief Measures the host time spent rasterising the L1 waveform rows
+ *
+ * Compares the span rasteriser of Src/Graph_L1_raster.c against the
+ * per-pixel Bresenham line it replaced, at every zoom level, and checks that
+ * both cover the same pixel columns. The samples are the simulated ECG, pleth
+ * and CO2 signals of the demo. The time comes from the microsecond clock of
+ * EVE_BenchClock.h. On x86 the time stamp counter gives the cycles per sample,
+ * on the RP2040 they are derived from the elapsed time and the system clock.
+ * Built by the Graph_Bench target when WITH_EVE_TOOLS is enabled.
+ * Usage: Graph_Bench [<sample count>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ */
+
+#include "EVE_Platform.h"
+#include "Graph_L1_raster.h"
+#include "signals_arrays.h"
+#include "EVE_BenchClock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(RP2040_PLATFORM)
+#include "hardware/clocks.h"
+#endif
+
+/** Same geometry as the demo, see Hdr/Bedside_Patient_Monitor_Demo.h */
+#define BENCH_GRAPH_W 160
+#define BENCH_BYTE_PER_LINE (BENCH_GRAPH_W / 8)
+#define BENCH_ZOOM_LV_MAX 8
+#define BENCH_SAMPLE_MAX 150 /* Graph height, the samples are scaled to 1 .. BENCH_SAMPLE_MAX */
+
+/**
+ * @brief Per-pixel reference, the Bresenham line with a bounds checked
+ * pixel write, as used before the span rasteriser
+ */
+static void benchPixel(uint8_t *buffer, int32_t x, int32_t y, int32_t rows)
+{
+	if (x < 0 || x >= BENCH_GRAPH_W)
+		return;
+	int32_t pixel_nth = x + y * BENCH_GRAPH_W;
+	int32_t byte_index = pixel_nth / 8;
+	int32_t bit_index = 7 - pixel_nth % 8;
+	if (byte_index >= BENCH_BYTE_PER_LINE * rows)
+		return;
+	buffer[byte_index] |= (1 << bit_index);
+}
+
+static void benchBresenham(uint8_t *buffer, int32_t rows, int32_t x_from, int32_t x_to)
+{
+	int32_t x1 = x_to, y1 = rows - 1, x2 = x_from, y2 = 0;
+	int32_t dx = abs(x2 - x1);
+	int32_t dy = abs(y2 - y1);
+	int32_t sx = (x2 > x1) ? 1 : -1;
+	int32_t sy = (y2 > y1) ? 1 : -1;
+	int32_t err = dx - dy;
+
+	memset(buffer, 0, BENCH_BYTE_PER_LINE * rows);
+	for (;;)
+	{
+		benchPixel(buffer, x1, y1, rows);
+		if (x1 == x2 && y1 == y2)
+			break;
+		int32_t e2 = 2 * err;
+		if (e2 > -dy)
+		{
+			err -= dy;
+			x1 += sx;
+		}
+		if (e2 < dx)
+		{
+			err += dx;
+			y1 += sy;
+		}
+	}
+}
+
+/**
+ * @brief Check that a rasterised segment covers the columns between the
+ * samples, starts at the previous sample and ends at the new one
+ */
+static bool benchCheck(const uint8_t *buffer, int32_t rows, int32_t x_from, int32_t x_to)
+{
+	int32_t lo = min(x_from, x_to);
+	int32_t hi = max(x_from, x_to);
+	int32_t x, r;
+
+#define BENCH_BIT(r, x) (buffer[(r)*BENCH_BYTE_PER_LINE + ((x) >> 3)] & (0x80 >> ((x)&7)))
+	if (!BENCH_BIT(0, x_from) || !BENCH_BIT(rows - 1, x_to))
+		return false;
+	for (x = 0; x < BENCH_GRAPH_W; ++x)
+	{
+		bool set = false;
+		for (r = 0; r < rows; ++r)
+			set = set || BENCH_BIT(r, x);
+		if (set != (x >= lo && x <= hi))
+			return false;
+	}
+#undef BENCH_BIT
+	return true;
+}
+
+/**
+ * @brief Convert the elapsed time into cycles where no cycle counter exists
+ */
+static uint64_t benchCycles(uint64_t cycles, uint64_t micros)
+{
+#if defined(RP2040_PLATFORM)
+	if (!cycles)
+		return micros * (clock_get_hz(clk_sys) / 1000000);
+#else
+	(void)micros;
+#endif
+	return cycles;
+}
+
+int main(int argc, char *argv[])
+{
+	static uint8_t buffer[BENCH_BYTE_PER_LINE * BENCH_ZOOM_LV_MAX];
+	static uint8_t samples[sizeof(ecg_data) + sizeof(ppg_data) + sizeof(co2_data)];
+	uint32_t count = 2000000;
+	uint32_t checked = 0;
+	uint32_t failed = 0;
+	uint32_t sink = 0;
+	int32_t zoom;
+	uint32_t i;
+
+	if (argc > 1)
+		count = max(1, atoi(argv[1]));
+
+	EVE_Hal_initialize();
+
+	/* Scaled like normalize_to_graph in Src/Graph_L1_rotate.c */
+	memcpy(samples, ecg_data, sizeof(ecg_data));
+	memcpy(samples + sizeof(ecg_data), ppg_data, sizeof(ppg_data));
+	memcpy(samples + sizeof(ecg_data) + sizeof(ppg_data), co2_data, sizeof(co2_data));
+	for (i = 0; i < sizeof(samples); ++i)
+		samples[i] = (uint8_t)(BENCH_SAMPLE_MAX - (BENCH_SAMPLE_MAX - 1) * (255 - samples[i]) / 255);
+
+	for (zoom = 1; zoom <= BENCH_ZOOM_LV_MAX; ++zoom)
+	{
+		uint64_t micros[2];
+		uint64_t cycles[2];
+		int pass;
+
+		for (i = 1; i < sizeof(samples); ++i)
+		{
+			graph_raster_segment(buffer, BENCH_BYTE_PER_LINE, zoom, BENCH_GRAPH_W, samples[i - 1], samples[i]);
+			++checked;
+			if (!benchCheck(buffer, zoom, samples[i - 1], samples[i]))
+				++failed;
+		}
+
+		for (pass = 0; pass < 2; ++pass)
+		{
+			uint64_t startMicros = EVE_BenchClock_micros();
+			uint64_t startCycles = EVE_BENCH_CYCLES();
+			for (i = 0; i < count; ++i)
+			{
+				uint32_t s = (i % (sizeof(samples) - 1)) + 1;
+				if (pass)
+					graph_raster_segment(buffer, BENCH_BYTE_PER_LINE, zoom, BENCH_GRAPH_W, samples[s - 1], samples[s]);
+				else
+					benchBresenham(buffer, zoom, samples[s - 1], samples[s]);
+				sink += buffer[samples[s] >> 3];
+			}
+			cycles[pass] = EVE_BENCH_CYCLES() - startCycles;
+			micros[pass] = max(1, EVE_BenchClock_micros() - startMicros);
+			cycles[pass] = benchCycles(cycles[pass], micros[pass]);
+		}
+
+		printf("zoom %i: per-pixel %u samples/s, span %u samples/s, %u.%02ux",
+		    (int)zoom, (unsigned)(count * 1000000ULL / micros[0]), (unsigned)(count * 1000000ULL / micros[1]),
+		    (unsigned)(micros[0] / micros[1]), (unsigned)(micros[0] * 100 / micros[1] % 100));
+		if (cycles[0] && cycles[1])
+			printf(", %u vs %u cycles per sample", (unsigned)(cycles[0] / count), (unsigned)(cycles[1] / count));
+		printf("\n");
+	}
+
+	printf("%u of %u segments checked OK%s\n", (unsigned)(checked - failed), (unsigned)checked, (sink & 0x10000000) ? " " : "");
+	EVE_Hal_release();
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+﻿/**
+ * @file Ring_Stress.c
+ * @brief Stress test of the demo sample ring under concurrent access
+ *
+ * Runs one producer thread per channel pushing numbered samples into a
+ * sample_ring_t of Src/Sample_Ring.c, while the main thread drains all the
+ * rings once per display frame, as the render loop does. Every sample taken
+ * must follow the previous one of its channel, and every sample produced must
+ * be either taken or counted as an overrun. The first pass uses the ring size
+ * of the demo and must not overrun while two frames of samples fit in it, the
+ * second uses a small ring to exercise the overrun path.
+ * Uses POSIX threads, built by the Ring_Stress target on Linux when
+ * WITH_EVE_TOOLS is enabled.
+ * Usage: Ring_Stress [<seconds per pass>] [<samples per second per channel>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ */
+
+#include "EVE_Platform.h"
+#include "Sample_Ring.h"
+#include "EVE_BenchClock.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRESS_CHANNELS 12
+#define STRESS_FRAME_MS 16 /**< Period of the consumer, one display frame */
+#define STRESS_TICK_MS 1 /**< Period of each producer */
+#define STRESS_RING_SIZE 1024 /**< Ring size of the first pass, as in the demo */
+#define STRESS_SMALL_RING_SIZE 16 /**< Ring size of the second pass, overruns at any rate above 1 kHz */
+
+typedef struct
+{
+	sample_ring_t Ring;
+	SIGNALS_DATA_TYPE Buffer[STRESS_RING_SIZE];
+	pthread_t Thread;
+	int32_t Rate;
+	uint32_t Produced; /**< Samples offered to the ring, producer side */
+	uint32_t Pushed; /**< Samples accepted by the ring, producer side */
+	uint32_t Popped; /**< Samples taken, consumer side */
+	uint32_t Errors; /**< Samples out of sequence, consumer side */
+} StressChannel;
+
+static StressChannel s_channels[STRESS_CHANNELS];
+static atomic_int s_running;
+
+static void stressSleep(uint32_t ms)
+{
+	struct timespec req = { 0, (long)ms * 1000000 };
+	nanosleep(&req, NULL);
+}
+
+/**
+ * @brief Producer, pushes the samples due every tick, numbered in push order
+ */
+static void *stressProducer(void *arg)
+{
+	StressChannel *channel = (StressChannel *)arg;
+	SIGNALS_DATA_TYPE samples[256];
+	uint64_t start = EVE_BenchClock_micros();
+	uint64_t due = 0;
+
+	while (atomic_load(&s_running))
+	{
+		uint64_t target = (EVE_BenchClock_micros() - start) * channel->Rate / 1000000;
+		while (due < target)
+		{
+			int32_t count = (int32_t)min(target - due, (uint64_t)sizeof(samples));
+			for (int32_t i = 0; i < count; ++i)
+				samples[i] = (SIGNALS_DATA_TYPE)(channel->Pushed + i);
+			/* Only the accepted samples are numbered, the consumer sees no gap */
+			channel->Pushed += sample_ring_push(&channel->Ring, samples, count);
+			channel->Produced += count;
+			due += count;
+		}
+		stressSleep(STRESS_TICK_MS);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Consumer, takes the waiting samples of one channel and checks their order
+ */
+static void stressDrain(StressChannel *channel)
+{
+	SIGNALS_DATA_TYPE samples[GRAPH_H];
+	int32_t count;
+
+	while ((count = sample_ring_pop(&channel->Ring, samples, GRAPH_H)) > 0)
+	{
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (samples[i] != (SIGNALS_DATA_TYPE)(channel->Popped + i))
+				++channel->Errors;
+		}
+		channel->Popped += count;
+	}
+}
+
+/**
+ * @brief Run the producers against the frame paced consumer
+ *
+ * @param expectOverruns 1 if the ring must overrun, 0 if it must not, -1 if either is fine
+ *
+ * @return Number of failed checks
+ */
+static int stressPass(uint32_t ringSize, uint32_t seconds, int32_t rate, int expectOverruns)
+{
+	uint32_t frames = 0;
+	uint32_t frameMaxMicros = 0;
+	uint32_t overruns = 0;
+	uint32_t peak = 0;
+	uint32_t produced = 0;
+	uint32_t popped = 0;
+	uint32_t errors = 0;
+	int failed = 0;
+	uint64_t end;
+
+	atomic_store(&s_running, 1);
+	for (int i = 0; i < STRESS_CHANNELS; ++i)
+	{
+		StressChannel *channel = &s_channels[i];
+		memset(channel, 0, sizeof(StressChannel));
+		sample_ring_init(&channel->Ring, channel->Buffer, ringSize);
+		channel->Rate = rate + i * rate / 10; /* Unrelated rates, the producers drift apart */
+		if (pthread_create(&channel->Thread, NULL, stressProducer, channel))
+		{
+			printf("Failed to start producer %i\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	end = EVE_BenchClock_micros() + (uint64_t)seconds * 1000000;
+	while (EVE_BenchClock_micros() < end)
+	{
+		uint64_t start = EVE_BenchClock_micros();
+		for (int i = 0; i < STRESS_CHANNELS; ++i)
+			stressDrain(&s_channels[i]);
+		frameMaxMicros = max(frameMaxMicros, (uint32_t)(EVE_BenchClock_micros() - start));
+		++frames;
+		stressSleep(STRESS_FRAME_MS);
+	}
+
+	atomic_store(&s_running, 0);
+	for (int i = 0; i < STRESS_CHANNELS; ++i)
+	{
+		StressChannel *channel = &s_channels[i];
+		uint32_t ringOverruns, ringPeak;
+
+		pthread_join(channel->Thread, NULL);
+		stressDrain(channel);
+		sample_ring_stats(&channel->Ring, &ringOverruns, &ringPeak);
+		if (channel->Popped != channel->Pushed || channel->Produced - channel->Pushed != ringOverruns || ringPeak > ringSize)
+		{
+			printf("Channel %i: %u produced, %u pushed, %u popped, %u overruns, peak %u\n", i,
+			    (unsigned)channel->Produced, (unsigned)channel->Pushed, (unsigned)channel->Popped, (unsigned)ringOverruns, (unsigned)ringPeak);
+			++failed;
+		}
+		produced += channel->Produced;
+		popped += channel->Popped;
+		errors += channel->Errors;
+		overruns += ringOverruns;
+		peak = max(peak, ringPeak);
+	}
+	if (errors)
+		++failed;
+	if ((expectOverruns > 0 && !overruns) || (!expectOverruns && overruns))
+		++failed;
+
+	printf("Ring of %u: %i channels from %i Hz, %u frames, %u samples produced, %u taken, %u overruns, %u out of sequence, peak %u, slowest drain %u us: %s\n",
+	    (unsigned)ringSize, STRESS_CHANNELS, (int)rate, (unsigned)frames, (unsigned)produced, (unsigned)popped,
+	    (unsigned)overruns, (unsigned)errors, (unsigned)peak, (unsigned)frameMaxMicros, failed ? "FAILED" : "passed");
+	return failed;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t seconds = 5;
+	int32_t rate = 1000;
+	int failed = 0;
+
+	if (argc > 1)
+		seconds = max(1, atoi(argv[1]));
+	if (argc > 2)
+		rate = max(1, atoi(argv[2]));
+
+	/* The fastest producer runs at 2.1 times the base rate */
+	failed += stressPass(STRESS_RING_SIZE, seconds, rate, (rate * 21 / 10) * 2 * STRESS_FRAME_MS / 1000 < STRESS_RING_SIZE ? 0 : -1);
+	failed += stressPass(STRESS_SMALL_RING_SIZE, seconds, rate, 1);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
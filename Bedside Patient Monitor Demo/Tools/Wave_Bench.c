@@ -0,0 +1,162 @@
+﻿/**
+ * @file Wave_Bench.c
+ * @brief Measures the per-channel cost of the demo waveform engine
+ *
+ * Registers 1 to WAVE_CHANNEL_MAX channels with the waveform engine of
+ * Src/Graph_L1_rotate.c, and draws them for a number of simulated 16 ms
+ * frames. Reports the host time per frame and per channel, the waveform bytes
+ * written to RAM_G and the coprocessor bytes. Built by the Wave_Bench target
+ * when WITH_EVE_TOOLS is enabled, preferably for the NULLDEV platform so the
+ * bus time is not included.
+ * Usage: Wave_Bench [<frame count>] [<sample rate>]
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * @license MIT License
+ *
+ * Copyright (c) 2025 Bridgetek Pte Ltd (BRTChip)
+ */
+
+#include "EVE_Platform.h"
+#include "Graph_L1_rotate.h"
+#include "EVE_BenchClock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Simulated display frame period */
+#define BENCH_FRAME_MS 16
+
+/* Globals the engine shares with the demo */
+EVE_HalContext s_halContext;
+EVE_HalContext *s_pHalContext = &s_halContext;
+int32_t g_graph_zoom_lv = 3;
+uint8_t btnStartState = BTN_START_INACTIVE;
+
+/** Triangle wave state of one channel */
+typedef struct
+{
+	int32_t phase;
+	int32_t step;
+} BenchWave;
+
+static BenchWave s_waves[WAVE_CHANNEL_MAX];
+
+/**
+ * @brief Channel source producing a triangle wave, never runs dry
+ */
+static int32_t benchSource(void *ctx, SIGNALS_DATA_TYPE *samples, int32_t count)
+{
+	BenchWave *wave = (BenchWave *)ctx;
+	for (int32_t i = 0; i < count; ++i)
+	{
+		wave->phase = (wave->phase + wave->step) & 511;
+		samples[i] = (SIGNALS_DATA_TYPE)(wave->phase < 256 ? wave->phase : 511 - wave->phase);
+	}
+	return count;
+}
+
+/**
+ * @brief Draw the registered channels for a number of frames
+ *
+ * @return Elapsed microseconds, cycles in *cycles, waveform bytes and writes added to *bytes and *writes
+ */
+static uint64_t benchFrames(EVE_HalContext *phost, uint32_t frames, uint32_t *now, uint64_t *cycles, uint32_t *bytes, uint32_t *writes)
+{
+	uint32_t frameBytes, frameWrites;
+	uint64_t startMicros = EVE_BenchClock_micros();
+	uint64_t startCycles = EVE_BENCH_CYCLES();
+	for (uint32_t i = 0; i < frames; ++i)
+	{
+		*now += BENCH_FRAME_MS;
+		EVE_CoCmd_dlStart(phost);
+		EVE_Cmd_wr32(phost, CLEAR(1, 1, 1));
+		wave_channel_draw_all(*now);
+		graph_l1_rotate_stats(&frameBytes, &frameWrites);
+		*bytes += frameBytes;
+		*writes += frameWrites;
+		EVE_Cmd_wr32(phost, DISPLAY());
+		EVE_CoCmd_swap(phost);
+	}
+	EVE_Cmd_waitFlush(phost);
+	*cycles = EVE_BENCH_CYCLES() - startCycles;
+	return max(1, EVE_BenchClock_micros() - startMicros);
+}
+
+int main(int argc, char *argv[])
+{
+	EVE_HalContext *phost = s_pHalContext;
+	static const int32_t channelCounts[] = { 1, 2, 4, 8, WAVE_CHANNEL_MAX };
+	uint32_t frames = 2000;
+	int32_t rate = 500;
+	uint32_t now = 0;
+
+	if (argc > 1)
+		frames = max(1, atoi(argv[1]));
+	if (argc > 2)
+		rate = max(1, atoi(argv[2]));
+
+	EVE_Hal_initialize();
+	if (!EVE_Util_openDeviceInteractive(phost, NULL))
+	{
+		printf("Failed to open device\n");
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+	if (!EVE_Util_bootupConfig(phost))
+	{
+		printf("Failed to boot up device\n");
+		EVE_Hal_close(phost);
+		EVE_Hal_release();
+		return EXIT_FAILURE;
+	}
+
+	printf("%u frames of %u ms, %i samples per second per channel, zoom %i\n",
+	    (unsigned)frames, (unsigned)BENCH_FRAME_MS, (int)rate, (int)g_graph_zoom_lv);
+	for (uint32_t c = 0; c < sizeof(channelCounts) / sizeof(channelCounts[0]); ++c)
+	{
+		int32_t channels = channelCounts[c];
+		uint32_t graphBytes = 0;
+		uint32_t graphWrites = 0;
+		EVE_HalStats stats;
+		uint64_t micros, cycles;
+
+		graph_l1_rotate_init();
+		for (int32_t i = 0; i < channels; ++i)
+		{
+			app_box box = INIT_APP_BOX(0, (i % 4) * (GRAPH_W + 8), GRAPH_H, GRAPH_W);
+			wave_channel_t *channel = wave_channel_create(&box, 0x00ff00ff, rate, (wave_range_t){ 0, 255 });
+			if (!channel)
+			{
+				printf("RAM_G full at %i channels\n", (int)i);
+				channels = i;
+				break;
+			}
+			s_waves[i].phase = i * 37;
+			s_waves[i].step = 3 + i;
+			wave_channel_source(channel, benchSource, &s_waves[i]);
+		}
+		if (!channels)
+			break;
+
+		benchFrames(phost, 1, &now, &cycles, &graphBytes, &graphWrites); /* Warm up */
+		graphBytes = 0;
+		graphWrites = 0;
+		EVE_Hal_statsReset(phost);
+		micros = benchFrames(phost, frames, &now, &cycles, &graphBytes, &graphWrites);
+		EVE_Hal_statsSnapshot(phost, &stats);
+
+		printf("%2i channels: %u ns per frame, %u ns per channel, %u waveform bytes in %u writes per frame, %u coprocessor bytes per frame",
+		    (int)channels, (unsigned)(micros * 1000 / frames), (unsigned)(micros * 1000 / frames / channels),
+		    (unsigned)(graphBytes / frames), (unsigned)(graphWrites / frames), (unsigned)(stats.CmdBytes / frames));
+		if (cycles)
+			printf(", %u cycles per channel", (unsigned)(cycles / frames / channels));
+		printf("\n");
+	}
+
+	graph_l1_rotate_init();
+	EVE_Hal_close(phost);
+	EVE_Hal_release();
+	return EXIT_SUCCESS;
+}
@@ -571,6 +571,9 @@ bool EVE_Cmd_waitFlush(EVE_HalContext *phost)
 	/* Command buffer empty */
 	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
 	phost->CmdWaiting = false;
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	phost->CmdFrameDone = phost->CmdFrameSubmitted;
+#endif
 	return true;
 }
 
@@ -675,6 +678,111 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value)
 	return EVE_Hal_rd32(phost, ptr) == value;
 }
 
+#if EVE_CMD_FRAMES_IN_FLIGHT
+/**
+ * @brief Address of the frame fence, right below the error report area
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t Address in RAM_G
+ */
+static inline uint32_t fenceAddr(EVE_HalContext *phost)
+{
+	return RAM_G + phost->DDR_RamSize - RAM_ERR_REPORT_MAX - 4;
+}
+
+/**
+ * @brief Submit the current frame, only waits when too many frames are pending
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t Sequence number of the submitted frame
+ */
+uint32_t EVE_Cmd_submitFrame(EVE_HalContext *phost)
+{
+	uint32_t seq;
+
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+
+	if (!phost->CmdFrameSubmitted)
+	{
+		/* First frame, no fence is pending yet */
+		EVE_Hal_wr32(phost, fenceAddr(phost), 0);
+		phost->CmdFrameDone = 0;
+	}
+
+	seq = phost->CmdFrameSubmitted + 1;
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_MEMWRITE);
+	EVE_Cmd_wr32(phost, fenceAddr(phost));
+	EVE_Cmd_wr32(phost, 4);
+	EVE_Cmd_wr32(phost, seq);
+	EVE_Cmd_endFunc(phost);
+	phost->CmdFrameSubmitted = seq;
+
+	if (seq - phost->CmdFrameDone > EVE_CMD_FRAMES_IN_FLIGHT)
+		EVE_Cmd_waitFrame(phost, seq - EVE_CMD_FRAMES_IN_FLIGHT);
+
+	return seq;
+}
+
+/**
+ * @brief Check if a submitted frame has been completed
+ *
+ * @param phost Pointer to Hal context
+ * @param seq Sequence number returned by EVE_Cmd_submitFrame
+ * @return true True if the frame is completed
+ * @return false False if the frame is still pending
+ */
+bool EVE_Cmd_frameDone(EVE_HalContext *phost, uint32_t seq)
+{
+	uint32_t fence;
+
+	if ((int32_t)(phost->CmdFrameDone - seq) >= 0)
+		return true;
+
+	fence = EVE_Hal_rd32(phost, fenceAddr(phost));
+	if ((int32_t)(fence - phost->CmdFrameDone) > 0)
+		phost->CmdFrameDone = fence;
+	return (int32_t)(phost->CmdFrameDone - seq) >= 0;
+}
+
+/**
+ * @brief Wait till a submitted frame has been completed
+ *
+ * @param phost Pointer to Hal context
+ * @param seq Sequence number returned by EVE_Cmd_submitFrame
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Cmd_waitFrame(EVE_HalContext *phost, uint32_t seq)
+{
+	uint16_t rp;
+	uint16_t wp;
+
+	eve_assert(!phost->CmdWaiting);
+	phost->CmdWaiting = true;
+	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
+	{
+		if (EVE_Cmd_frameDone(phost, seq))
+		{
+			phost->CmdWaiting = false;
+			return true;
+		}
+		if (!handleWait(phost, rp))
+		{
+			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
+			return false;
+		}
+	}
+
+	/* Command buffer empty, all submitted frames are completed */
+	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
+	phost->CmdWaiting = false;
+	phost->CmdFrameDone = phost->CmdFrameSubmitted;
+	return true;
+}
+#endif
+
 /** Restore the internal state of EVE_Cmd.
  * Call this after manually writing to the coprocessor buffer
  */
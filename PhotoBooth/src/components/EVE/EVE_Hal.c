@@ -281,6 +281,77 @@ void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const u
 	EVE_Hal_endTransfer(phost);
 }
 
+/** Maximum number of vectors that EVE_Hal_wrv sorts by address */
+#define EVE_HAL_WRV_SORT_MAX 32
+
+/**
+ * @brief Sort vectors by destination address, if it is safe to reorder them
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write
+ * @param n Number of vectors
+ * @param order Receives the write order
+ * @return true True if the vectors can be written in the sorted order
+ * @return false False if they must be written in the specified order
+ */
+static bool wrvSort(EVE_HalContext *phost, const EVE_IoVec *v, size_t n, uint8_t *order)
+{
+	size_t i, j;
+
+	if (n > EVE_HAL_WRV_SORT_MAX)
+		return false;
+
+	/* Only RAM_G writes are free of side effects */
+	for (i = 0; i < n; ++i)
+	{
+		uint32_t offset = v[i].Addr - RAM_G;
+		if (offset >= phost->DDR_RamSize || v[i].Size > phost->DDR_RamSize - offset)
+			return false;
+	}
+
+	/* Stable insertion sort, the number of vectors is small */
+	for (i = 0; i < n; ++i)
+	{
+		uint8_t idx = (uint8_t)i;
+		for (j = i; j > 0 && v[order[j - 1]].Addr > v[idx].Addr; --j)
+			order[j] = order[j - 1];
+		order[j] = idx;
+	}
+
+	/* Overlapping writes must keep their order */
+	for (i = 1; i < n; ++i)
+	{
+		const EVE_IoVec *prev = &v[order[i - 1]];
+		if (prev->Addr + prev->Size > v[order[i]].Addr)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Write a list of buffers to Coprocessor's memory, joining contiguous destinations
+ *
+ * @param phost Pointer to Hal context
+ * @param v Vectors to write
+ * @param n Number of vectors
+ */
+void EVE_Hal_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n)
+{
+	EVE_IoVec sorted[EVE_HAL_WRV_SORT_MAX];
+	uint8_t order[EVE_HAL_WRV_SORT_MAX];
+	size_t i;
+
+	if (wrvSort(phost, v, n, order))
+	{
+		for (i = 0; i < n; ++i)
+			sorted[i] = v[order[i]];
+		v = sorted;
+	}
+
+	EVE_HalImpl_wrv(phost, v, n);
+}
+
 /**
  * @brief Write a string to Coprocessor's memory
  *
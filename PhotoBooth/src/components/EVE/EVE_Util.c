@@ -684,6 +684,9 @@ bool EVE_Util_resetCoprocessor(EVE_HalContext *phost)
 
 	/* Default */
 	phost->CmdFault = false;
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	phost->CmdFrameDone = phost->CmdFrameSubmitted; /* Pending frames are lost */
+#endif
 
 	/* Set REG_CPURESET to 0, to restart the coprocessor */
 	EVE_Hal_wr8(phost, REG_CPURESET, 0);
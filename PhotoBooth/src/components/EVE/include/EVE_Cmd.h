@@ -136,6 +136,30 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value);
 Call this after manually writing the the coprocessor buffer */
 void EVE_Cmd_restore(EVE_HalContext *phost);
 
+/** Bytes at the back of RAM_G used by the HAL, the error report area and
+the frame fence below it. Memory allocators must end below them */
+#if EVE_CMD_FRAMES_IN_FLIGHT
+#define EVE_CMD_RAM_G_RESERVED (RAM_ERR_REPORT_MAX + 4)
+#else
+#define EVE_CMD_RAM_G_RESERVED RAM_ERR_REPORT_MAX
+#endif
+
+#if EVE_CMD_FRAMES_IN_FLIGHT
+/** Submit the current frame without waiting for the coprocessor.
+Call after CMD_SWAP. Writes a fence into RAM_G, right below the error
+report area at the back of RAM_G. Only waits when `EVE_CMD_FRAMES_IN_FLIGHT`
+frames are already pending. Returns the sequence number of the frame */
+uint32_t EVE_Cmd_submitFrame(EVE_HalContext *phost);
+
+/** Check if the coprocessor has completed the frame with the specified
+sequence number. Does not wait */
+bool EVE_Cmd_frameDone(EVE_HalContext *phost, uint32_t seq);
+
+/** Wait for the coprocessor to complete the frame with the specified
+sequence number. Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_waitFrame(EVE_HalContext *phost, uint32_t seq);
+#endif
+
 #endif /* #ifndef EVE_CMD__H */
 
 /* end of file */
\ No newline at end of file
@@ -182,6 +182,8 @@ These may only be set by one of the platform target definitions, and should not
 // Other options
 #define EVE_CMD_HOOKS 0 /**< Allow adding a callback hook into EVE_CoCmd calls using CoCmdHook in EVE_HalContext */
 
+#define EVE_CMD_FRAMES_IN_FLIGHT 2 /**< Maximum number of frames submitted by EVE_Cmd_submitFrame that may be pending on the coprocessor, 0 to disable */
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
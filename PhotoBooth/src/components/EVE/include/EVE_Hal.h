@@ -76,6 +76,13 @@ void EVE_Hal_wr32(EVE_HalContext *phost, uint32_t addr, uint32_t v);
 void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size);
 void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const uint8_t *buffer, uint32_t size);
 void EVE_Hal_wrString(EVE_HalContext *phost, uint32_t addr, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
+
+/** Write a list of buffers to scattered addresses.
+Buffers with contiguous destinations are written in a single transfer.
+When all destinations are in RAM_G and do not overlap, they are written in
+address order, to join as many of them as possible.
+Register writes are always done in the specified order */
+void EVE_Hal_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
 ///@}
 
 /** @name SPI command */
@@ -153,6 +153,14 @@ typedef int (*EVE_CoCmdHook)(EVE_HalContext *phost, uint32_t cmd, uint32_t state
 /** Hook into coprocessor reset */
 typedef void (*EVE_ResetCallback)(EVE_HalContext *phost, bool fault);
 
+/** One destination region of a vectored write, see EVE_Hal_wrv */
+typedef struct EVE_IoVec
+{
+	uint32_t Addr; /**< Destination address */
+	const uint8_t *Buffer; /**< Data to write */
+	uint32_t Size; /**< Size of the data in bytes */
+} EVE_IoVec;
+
 typedef struct EVE_DeviceInfo
 {
 	char DisplayName[256];
@@ -212,6 +220,14 @@ typedef struct EVE_HalContext
 	uint16_t CmdSpace; /**< Free space, cached value */
 					   ///@}
 
+	/** @name Frame fence, for frames submitted without waiting for the coprocessor */
+	///@{
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	uint32_t CmdFrameSubmitted; /**< Sequence number of the last submitted frame */
+	uint32_t CmdFrameDone; /**< Sequence number of the last frame known to be completed */
+#endif
+	///@}
+
 	/** @name Media FIFO state */
 	///@{
 #if defined(EVE_SUPPORT_MEDIAFIFO)
@@ -87,6 +87,29 @@ void EVE_Hal_transferMem(EVE_HalContext *phost, uint8_t *result, const uint8_t *
 void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem_const uint8_t *buffer, uint32_t size);
 uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 void EVE_Hal_flush(EVE_HalContext *phost);
+
+/** Write vectors to Coprocessor's memory in the given order.
+Each contiguous run is sent as one bus transfer with a single address phase.
+Implemented natively by the backend, called by EVE_Hal_wrv */
+void EVE_HalImpl_wrv(EVE_HalContext *phost, const EVE_IoVec *v, size_t n);
+
+/** Find the contiguous run of vectors starting at v[0].
+Returns the number of vectors in the run, and its total size in bytes.
+Empty vectors never break a run */
+static inline size_t EVE_HalImpl_wrvRun(const EVE_IoVec *v, size_t n, uint32_t *size)
+{
+	uint32_t total = v[0].Size;
+	size_t i;
+
+	for (i = 1; i < n; ++i)
+	{
+		if (v[i].Size && v[i].Addr != v[0].Addr + total)
+			break;
+		total += v[i].Size;
+	}
+	*size = total;
+	return i;
+}
 ///@}
 
 /** @name UTILITY */
@@ -257,9 +257,9 @@ static void init()
     page_camera.isActive = 1;
     page_taskbar.isActive = 1;
 
-    // init EVE's DDR memory
+    // init EVE's DDR memory, up to the error report area and frame fence the HAL keeps at its end
     const uint32_t max_ramg = 2 * 1024 * 1024 * 1024; // maximum 2 GB of memory
-    utils_ddrInit(PHOST->DDR_RamSize > 0 ? PHOST->DDR_RamSize : max_ramg);
+    utils_ddrInit((PHOST->DDR_RamSize > 0 ? PHOST->DDR_RamSize : max_ramg) - EVE_CMD_RAM_G_RESERVED);
 
 #define ENABLE_SCREEN_ROTATE 0
 #if ENABLE_SCREEN_ROTATE
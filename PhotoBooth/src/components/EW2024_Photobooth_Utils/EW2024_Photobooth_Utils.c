@@ -240,7 +240,11 @@ void utils_displayEnd(EVE_HalContext *phost)
 	EVE_CoDl_display(PHOST);
 	EVE_CoCmd_swap(PHOST);
 	EVE_CoCmd_graphicsfinish(PHOST);
+#if EVE_CMD_FRAMES_IN_FLIGHT
+	EVE_Cmd_submitFrame(PHOST);
+#else
 	EVE_Cmd_waitFlush(PHOST);
+#endif
 }
 
 void utils_playMuteSound(EVE_HalContext *phost)